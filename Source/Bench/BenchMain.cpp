@@ -0,0 +1,472 @@
+/*
+  ==============================================================================
+
+    BenchMain.cpp
+    Created: 16 Oct 2026
+    Description: Headless DSP benchmark. Renders both engines over a set of
+                 scenarios and prints the timings as JSON, so results can be
+                 compared across commits.
+
+                 NEURONiK_Bench [--sample-rates 44100,48000] [--block-sizes 64,256]
+                                [--blocks 2000] [--warmup 50] [--voices 8]
+                                [--threads 1] [--scenario <substring>]
+                                [--output results.json] [--list]
+                                [--check-coefficients]
+
+                 --check-coefficients compares the SIMD ResonatorBank
+                 coefficient kernel against the reference RBJ design (std::sin /
+                 std::cos) and times both; exits with 1 if the responses differ
+                 by more than the tolerance.
+
+  ==============================================================================
+*/
+
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "../DSP/CoreModules/NeuronikEngine.h"
+#include "../DSP/CoreModules/NeurotikEngine.h"
+#include "../DSP/CoreModules/ResonatorBank.h"
+#include "../DSP/CoreModules/ResonatorKernels.h"
+#include "../DSP/Synthesis/AdditiveVoice.h"
+#include "../DSP/Synthesis/NeurotikVoice.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace NEURONiK::DSP;
+
+namespace {
+
+enum class EngineKind { Neuronik, Neurotik };
+
+struct Scenario
+{
+    const char* name;
+    EngineKind engine;
+    int fixedVoices;        // 0 = use --voices
+    Synthesis::AdditiveVoice::Params additive;
+    Synthesis::NeurotikVoice::Params neurotik;
+    GlobalParams globals;
+    Core::ResonatorBank::Mode resonatorMode = Core::ResonatorBank::Mode::Biquad;
+};
+
+struct BenchConfig
+{
+    juce::Array<double> sampleRates { 48000.0 };
+    juce::Array<int> blockSizes { 64, 256 };
+    int numBlocks = 2000;
+    int warmupBlocks = 50;
+    int numVoices = 8;
+    int renderThreads = 1;
+    juce::String scenarioFilter;
+};
+
+GlobalParams makeFxParams()
+{
+    GlobalParams g;
+    g.saturationAmt = 0.5f;
+    g.saturationQuality = 1;
+    g.chorusMix = 0.4f;
+    g.delayTime = 0.35f;
+    g.delayFB = 0.5f;
+    g.reverbMix = 0.35f;
+    return g;
+}
+
+std::vector<Scenario> makeScenarios()
+{
+    std::vector<Scenario> scenarios;
+
+    auto add = [&scenarios](const char* name, EngineKind engine, int fixedVoices, auto&& configure)
+    {
+        Scenario s { name, engine, fixedVoices, {}, {}, {}, Core::ResonatorBank::Mode::Biquad };
+        configure(s);
+        scenarios.push_back(s);
+    };
+
+    add("neuronik/default",      EngineKind::Neuronik, 0,  [](Scenario&) {});
+    add("neuronik/unison-off",   EngineKind::Neuronik, 0,  [](Scenario& s) { s.additive.unisonDetune = 0.0f; });
+    add("neuronik/roughness",    EngineKind::Neuronik, 0,  [](Scenario& s) { s.additive.roughness = 0.5f; });
+    add("neuronik/fx",           EngineKind::Neuronik, 0,  [](Scenario& s) { s.globals = makeFxParams(); });
+    add("neuronik/32-voices",    EngineKind::Neuronik, 32, [](Scenario&) {});
+    add("neurotik/default",      EngineKind::Neurotik, 0,  [](Scenario&) {});
+    add("neurotik/unison-off",   EngineKind::Neurotik, 0,  [](Scenario& s) { s.neurotik.unisonDetune = 0.0f; });
+    add("neurotik/fx",           EngineKind::Neurotik, 0,  [](Scenario& s) { s.globals = makeFxParams(); });
+    add("neurotik/fx-reverb-8",  EngineKind::Neurotik, 0,  [](Scenario& s) { s.globals = makeFxParams(); s.globals.reverbQuality = 0; });
+    add("neurotik/fx-sat-4x",    EngineKind::Neurotik, 0,  [](Scenario& s) { s.globals = makeFxParams(); s.globals.saturationQuality = 2; });
+    add("neurotik/32-voices",    EngineKind::Neurotik, 32, [](Scenario&) {});
+    add("neurotik/modal",        EngineKind::Neurotik, 0,  [](Scenario& s) { s.resonatorMode = Core::ResonatorBank::Mode::Modal; });
+    add("neurotik/modal-32",     EngineKind::Neurotik, 32, [](Scenario& s) { s.resonatorMode = Core::ResonatorBank::Mode::Modal; });
+
+    return scenarios;
+}
+
+double percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    const double rank = p * (double)(sorted.size() - 1);
+    const auto lower = (size_t)rank;
+    const auto upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (rank - (double)lower);
+}
+
+void setVoiceParams(NeuronikEngine& e, const Scenario& s) { e.setVoiceParams(s.additive); }
+void setVoiceParams(NeurotikEngine& e, const Scenario& s)
+{
+    e.setVoiceParams(s.neurotik);
+    e.setResonatorMode(s.resonatorMode);
+}
+
+template <typename EngineT>
+juce::var runScenario(const Scenario& scenario, double sampleRate, int blockSize, const BenchConfig& config)
+{
+    const int numVoices = juce::jmin(scenario.fixedVoices > 0 ? scenario.fixedVoices : config.numVoices,
+                                     EngineT::maxVoices);
+
+    auto engine = std::make_unique<EngineT>();
+    engine->setPolyphony(numVoices);
+    engine->setRenderThreads(config.renderThreads);
+    engine->prepare(sampleRate, blockSize);
+    setVoiceParams(*engine, scenario);
+    engine->setGlobalParams(scenario.globals);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    std::vector<double> blockNanos;
+    blockNanos.reserve((size_t)config.numBlocks);
+
+    const double nanosPerTick = 1.0e9 / (double)juce::Time::getHighResolutionTicksPerSecond();
+    double sumSquares = 0.0;
+
+    for (int block = 0; block < config.warmupBlocks + config.numBlocks; ++block)
+    {
+        // Notes are held for the whole run so every voice stays in its sustain stage
+        midi.clear();
+        if (block == 0)
+            for (int v = 0; v < numVoices; ++v)
+                midi.addEvent(juce::MidiMessage::noteOn(1, 36 + 2 * v, 0.8f), 0);
+
+        buffer.clear();
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        engine->renderNextBlock(buffer, midi);
+        const auto end = juce::Time::getHighResolutionTicks();
+
+        if (block < config.warmupBlocks)
+            continue;
+
+        blockNanos.push_back((double)(end - start) * nanosPerTick);
+
+        const float* left = buffer.getReadPointer(0);
+        for (int i = 0; i < blockSize; ++i)
+            sumSquares += (double)left[i] * (double)left[i];
+    }
+
+    std::vector<double> sorted(blockNanos);
+    std::sort(sorted.begin(), sorted.end());
+
+    double totalNanos = 0.0;
+    for (double t : blockNanos)
+        totalNanos += t;
+
+    const double numSamples = (double)config.numBlocks * (double)blockSize;
+    const double meanBlockNanos = totalNanos / (double)config.numBlocks;
+    const double blockPeriodNanos = 1.0e9 * (double)blockSize / sampleRate;
+    const double meanLoad = meanBlockNanos / blockPeriodNanos;
+    const int activeVoices = engine->getNumActiveVoices();
+
+    // Voices one core could carry at 50% of the real-time budget (linear in voice count)
+    const double voicesPerCore = (meanLoad > 0.0 && activeVoices > 0)
+        ? 0.5 * (double)activeVoices / (meanLoad * (double)config.renderThreads)
+        : 0.0;
+
+    auto toMicros = [](double nanos) { return nanos * 1.0e-3; };
+
+    auto* blockStats = new juce::DynamicObject();
+    blockStats->setProperty("mean", toMicros(meanBlockNanos));
+    blockStats->setProperty("p50", toMicros(percentile(sorted, 0.50)));
+    blockStats->setProperty("p90", toMicros(percentile(sorted, 0.90)));
+    blockStats->setProperty("p99", toMicros(percentile(sorted, 0.99)));
+    blockStats->setProperty("p999", toMicros(percentile(sorted, 0.999)));
+    blockStats->setProperty("max", toMicros(sorted.back()));
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("scenario", scenario.name);
+    result->setProperty("sampleRate", sampleRate);
+    result->setProperty("blockSize", blockSize);
+    result->setProperty("blocks", config.numBlocks);
+    result->setProperty("voices", numVoices);
+    result->setProperty("activeVoices", activeVoices);
+    result->setProperty("renderThreads", engine->getRenderThreads());
+    result->setProperty("nsPerSample", totalNanos / numSamples);
+    result->setProperty("nsPerVoiceSample", activeVoices > 0 ? totalNanos / (numSamples * activeVoices) : 0.0);
+    result->setProperty("meanLoad", meanLoad);
+    result->setProperty("p99Load", percentile(sorted, 0.99) / blockPeriodNanos);
+    result->setProperty("voicesPerCoreAt50", voicesPerCore);
+    result->setProperty("blockMicros", juce::var(blockStats));
+    result->setProperty("outputRms", std::sqrt(sumSquares / numSamples)); // catches silent/broken renders
+
+    return juce::var(result);
+}
+
+//==============================================================================
+// The coefficient design ResonatorBank used before the bankCoefficients kernel
+void designReferenceBandPass(const float* omegas, float invTwoQ, float* b0, float* b2, float* a1, float* a2,
+                             int numFilters)
+{
+    for (int i = 0; i < numFilters; ++i)
+    {
+        if (omegas[i] <= 0.0f)
+        {
+            b0[i] = b2[i] = a1[i] = a2[i] = 0.0f;
+            continue;
+        }
+
+        const float cosW = std::cos(omegas[i]);
+        const float alpha = std::sin(omegas[i]) * invTwoQ;
+        const float invA0 = 1.0f / (1.0f + alpha);
+
+        b0[i] = alpha * invA0;
+        b2[i] = -alpha * invA0;
+        a1[i] = (-2.0f * cosW) * invA0;
+        a2[i] = (1.0f - alpha) * invA0;
+    }
+}
+
+double magnitudeDb(float b0, float b2, float a1, float a2, double omega)
+{
+    const auto z1 = std::polar(1.0, -omega);
+    const auto z2 = z1 * z1;
+    const auto response = ((double)b0 + (double)b2 * z2) / (1.0 + (double)a1 * z1 + (double)a2 * z2);
+    return 20.0 * std::log10(std::abs(response) + 1.0e-30);
+}
+
+/**
+ * Sweeps centre frequencies (20 Hz to the bank's 0.48 * fs limit) over the
+ * resonance range and compares the magnitude response of both designs at the
+ * centre and at the half-power edges. Also times a 128-filter update with
+ * each design and a full ResonatorBank::updateParameters.
+ */
+juce::var runCoefficientCheck(double sampleRate, const BenchConfig& config, bool& passed)
+{
+    constexpr int numFilters = 128;
+    constexpr double toleranceDb = 0.1;
+
+    const auto& kernels = Core::Kernels::selectResonatorKernels();
+
+    alignas(64) float omegas[numFilters];
+    alignas(64) float refB0[numFilters], refB2[numFilters], refA1[numFilters], refA2[numFilters];
+    alignas(64) float simdB0[numFilters], simdB2[numFilters], simdA1[numFilters], simdA2[numFilters];
+
+    const double lowestHz = 20.0;
+    const double highestHz = 0.48 * sampleRate;
+    const double radiansPerHz = juce::MathConstants<double>::twoPi / sampleRate;
+
+    double maxDeviationDb = 0.0, worstHz = 0.0, worstQ = 0.0;
+    double maxCoefficientError = 0.0;
+
+    for (float resonance : { 0.0f, 0.25f, 0.5f, 0.75f, 0.9f, 1.0f })
+    {
+        // Same mapping as ResonatorBank::updateParameters
+        const float q = 1.0f + resonance * resonance * 199.0f;
+        const float invTwoQ = 1.0f / (2.0f * q);
+
+        for (int sweep = 0; sweep < 8; ++sweep)
+        {
+            for (int i = 0; i < numFilters; ++i)
+            {
+                const double position = ((double)i + sweep / 8.0) / (double)numFilters;
+                const double hz = juce::jmin(lowestHz * std::pow(highestHz / lowestHz, position), highestHz * 0.999);
+                omegas[i] = (float)(hz * radiansPerHz);
+            }
+
+            designReferenceBandPass(omegas, invTwoQ, refB0, refB2, refA1, refA2, numFilters);
+            kernels.bankCoefficients(omegas, invTwoQ, simdB0, simdB2, simdA1, simdA2, numFilters);
+
+            for (int i = 0; i < numFilters; ++i)
+            {
+                maxCoefficientError = std::max({ maxCoefficientError,
+                                                 (double)std::abs(refB0[i] - simdB0[i]), (double)std::abs(refB2[i] - simdB2[i]),
+                                                 (double)std::abs(refA1[i] - simdA1[i]), (double)std::abs(refA2[i] - simdA2[i]) });
+
+                const double omega = omegas[i];
+                for (double probe : { omega, omega * (1.0 - 0.5 / q), omega * (1.0 + 0.5 / q) })
+                {
+                    if (probe >= juce::MathConstants<double>::pi)
+                        continue;
+
+                    const double deviation = std::abs(magnitudeDb(refB0[i], refB2[i], refA1[i], refA2[i], probe)
+                                                      - magnitudeDb(simdB0[i], simdB2[i], simdA1[i], simdA2[i], probe));
+                    if (deviation > maxDeviationDb)
+                    {
+                        maxDeviationDb = deviation;
+                        worstHz = omega / radiansPerHz;
+                        worstQ = q;
+                    }
+                }
+            }
+        }
+    }
+
+    // Timing: nudge one omega per pass so nothing can be hoisted out of the loop
+    const int numUpdates = config.numBlocks;
+    const double nanosPerTick = 1.0e9 / (double)juce::Time::getHighResolutionTicksPerSecond();
+    float checksum = 0.0f;
+
+    auto timeUpdates = [&](auto&& update)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+        for (int n = 0; n < numUpdates; ++n)
+        {
+            omegas[0] = (float)((100.0 + (n & 1)) * radiansPerHz);
+            update();
+            checksum += simdA1[0] + refA1[0];
+        }
+        return (double)(juce::Time::getHighResolutionTicks() - start) * nanosPerTick / (double)numUpdates;
+    };
+
+    const double referenceNanos = timeUpdates([&] { designReferenceBandPass(omegas, 0.01f, refB0, refB2, refA1, refA2, numFilters); });
+    const double kernelNanos = timeUpdates([&] { kernels.bankCoefficients(omegas, 0.01f, simdB0, simdB2, simdA1, simdA2, numFilters); });
+
+    // A whole per-voice bank update (morph, mapping and coefficients), forced by a pitch change
+    Core::ResonatorBank bank;
+    bank.setSampleRate(sampleRate);
+    const auto bankStart = juce::Time::getHighResolutionTicks();
+    for (int n = 0; n < numUpdates; ++n)
+    {
+        bank.setBaseFrequency((n & 1) != 0 ? 220.0f : 221.0f);
+        bank.updateParameters(0.5f, 0.5f, 0.9f, 0.01f);
+    }
+    const double bankNanos = (double)(juce::Time::getHighResolutionTicks() - bankStart) * nanosPerTick / (double)numUpdates;
+
+    const bool withinTolerance = maxDeviationDb <= toleranceDb && std::isfinite(checksum);
+    passed = passed && withinTolerance;
+
+    auto* updateNanos = new juce::DynamicObject();
+    updateNanos->setProperty("referenceRbj", referenceNanos);
+    updateNanos->setProperty("kernel", kernelNanos);
+    updateNanos->setProperty("speedup", kernelNanos > 0.0 ? referenceNanos / kernelNanos : 0.0);
+
+    auto* result = new juce::DynamicObject();
+    result->setProperty("check", "resonatorBankCoefficients");
+    result->setProperty("sampleRate", sampleRate);
+    result->setProperty("kernels", kernels.name);
+    result->setProperty("maxResponseDeviationDb", maxDeviationDb);
+    result->setProperty("worstCentreHz", worstHz);
+    result->setProperty("worstQ", worstQ);
+    result->setProperty("maxCoefficientError", maxCoefficientError);
+    result->setProperty("toleranceDb", toleranceDb);
+    result->setProperty("passed", withinTolerance);
+    result->setProperty("nsPer128FilterUpdate", juce::var(updateNanos));
+    result->setProperty("nsPerBankUpdate", bankNanos);
+
+    return juce::var(result);
+}
+
+template <typename ValueType>
+juce::Array<ValueType> parseList(const juce::String& text)
+{
+    juce::Array<ValueType> values;
+    for (const auto& token : juce::StringArray::fromTokens(text, ",", ""))
+    {
+        if (token.trim().isNotEmpty())
+            values.add((ValueType)token.trim().getDoubleValue());
+    }
+    return values;
+}
+
+BenchConfig parseArguments(const juce::ArgumentList& args)
+{
+    BenchConfig config;
+
+    if (args.containsOption("--sample-rates"))
+        config.sampleRates = parseList<double>(args.getValueForOption("--sample-rates"));
+    if (args.containsOption("--block-sizes"))
+        config.blockSizes = parseList<int>(args.getValueForOption("--block-sizes"));
+    if (args.containsOption("--blocks"))
+        config.numBlocks = juce::jmax(1, args.getValueForOption("--blocks").getIntValue());
+    if (args.containsOption("--warmup"))
+        config.warmupBlocks = juce::jmax(0, args.getValueForOption("--warmup").getIntValue());
+    if (args.containsOption("--voices"))
+        config.numVoices = juce::jlimit(1, 32, args.getValueForOption("--voices").getIntValue());
+    if (args.containsOption("--threads"))
+        config.renderThreads = juce::jlimit(1, VoiceRenderPool::maxLanes, args.getValueForOption("--threads").getIntValue());
+    if (args.containsOption("--scenario"))
+        config.scenarioFilter = args.getValueForOption("--scenario");
+
+    return config;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const juce::ArgumentList args(argc, argv);
+    const auto scenarios = makeScenarios();
+
+    if (args.containsOption("--list"))
+    {
+        for (const auto& s : scenarios)
+            std::cout << s.name << "\n";
+        return 0;
+    }
+
+    const auto config = parseArguments(args);
+
+    juce::Array<juce::var> results;
+    const bool checkCoefficients = args.containsOption("--check-coefficients");
+    bool passed = true;
+
+    if (checkCoefficients)
+    {
+        for (double sampleRate : config.sampleRates)
+            results.add(runCoefficientCheck(sampleRate, config, passed));
+    }
+    else
+    {
+        for (const auto& scenario : scenarios)
+        {
+            if (config.scenarioFilter.isNotEmpty() && !juce::String(scenario.name).contains(config.scenarioFilter))
+                continue;
+
+            for (double sampleRate : config.sampleRates)
+            {
+                for (int blockSize : config.blockSizes)
+                {
+                    if (scenario.engine == EngineKind::Neuronik)
+                        results.add(runScenario<NeuronikEngine>(scenario, sampleRate, blockSize, config));
+                    else
+                        results.add(runScenario<NeurotikEngine>(scenario, sampleRate, blockSize, config));
+                }
+            }
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty("benchmark", "NEURONiK_Bench");
+    report->setProperty("formatVersion", 1);
+    report->setProperty("kernels", Core::Kernels::selectResonatorKernels().name);
+    report->setProperty("numCpus", juce::SystemStats::getNumCpus());
+    report->setProperty("results", results);
+
+    const auto json = juce::JSON::toString(juce::var(report));
+
+    if (args.containsOption("--output"))
+    {
+        const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--output"));
+        if (!file.replaceWithText(json))
+        {
+            std::cerr << "Could not write " << args.getValueForOption("--output") << "\n";
+            return 1;
+        }
+        return passed ? 0 : 1;
+    }
+
+    std::cout << json << std::endl;
+    return passed ? 0 : 1;
+}
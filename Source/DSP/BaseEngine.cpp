@@ -8,14 +8,11 @@
 */
 
 #include "BaseEngine.h"
+#include "CoreModules/ResonatorKernels.h"
 
 namespace NEURONiK::DSP {
 
-BaseEngine::BaseEngine()
-{
-}
-
-void BaseEngine::prepare(double sampleRate, int samplesPerBlock)
+void EngineGlobals::prepareGlobals(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
     currentSamplesPerBlock = samplesPerBlock;
@@ -29,21 +26,25 @@ void BaseEngine::prepare(double sampleRate, int samplesPerBlock)
     lfo2.setSampleRate(sampleRate);
     
     masterLevelSmoother.reset(sampleRate, 0.05);
-    
-    for (auto& voice : voices)
-    {
-        if (voice) voice->prepare(sampleRate, samplesPerBlock);
-    }
+
+    // Workers are spawned here, off the audio thread; setRenderThreads only picks how many run
+    renderPool.prepare();
+
+    juce::Logger::writeToLog("NEURONiK DSP: using " + juce::String(getActiveKernelName()) + " resonator kernels");
 }
 
-void BaseEngine::updateParameters()
+void EngineGlobals::updateGlobalParameters()
 {
-    currentGlobalParams = pendingGlobalParams;
+    blockGlobalParams = globalParamChannel.acquire().value;
+    currentGlobalParams = blockGlobalParams;
+    compileModMatrix();
     
     saturation.setDrive(currentGlobalParams.saturationAmt);
+    saturation.setQuality(static_cast<Effects::Saturation::Quality>(juce::jlimit(0, 2, currentGlobalParams.saturationQuality)));
     delay.setParameters(currentGlobalParams.delayTime, currentGlobalParams.delayFB);
     chorus.setMix(currentGlobalParams.chorusMix);
     reverb.setMix(currentGlobalParams.reverbMix);
+    reverb.setQuality(static_cast<Effects::Reverb::Quality>(juce::jlimit(0, 1, currentGlobalParams.reverbQuality)));
     
     masterLevelSmoother.setTargetValue(currentGlobalParams.masterLevel);
     
@@ -54,14 +55,9 @@ void BaseEngine::updateParameters()
     lfo2.setWaveform(static_cast<Core::LFO::Waveform>(currentGlobalParams.lfo2.waveform));
     lfo2.setRate(currentGlobalParams.lfo2.rateHz);
     lfo2.setDepth(currentGlobalParams.lfo2.depth);
-    
-    for (auto& voice : voices)
-    {
-        if (voice) voice->updateParameters();
-    }
 }
 
-void BaseEngine::reset()
+void EngineGlobals::resetGlobals()
 {
     saturation.resetState();
     delay.reset();
@@ -70,67 +66,123 @@ void BaseEngine::reset()
     
     lfo1.reset();
     lfo2.reset();
-    
-    for (auto& voice : voices)
+
+    samplesUntilControlTick = 0;
+}
+
+float EngineGlobals::getLfoValue(int index) const
+{
+    return (index == 0) ? lfo1Value.load() : lfo2Value.load();
+}
+
+void EngineGlobals::compileModMatrix() noexcept
+{
+    numModOperations = 0;
+
+    for (const auto& route : blockGlobalParams.modMatrix)
     {
-        if (voice) voice->reset();
+        if (route.source <= 0 || route.source >= numModSources
+            || route.destination <= 0 || route.destination >= numModDestinations)
+            continue;
+
+        modOperations[(size_t)numModOperations++] = { modSources[route.source], route.destination, route.amount };
     }
 }
 
-void BaseEngine::handleMidiMessage(const juce::MidiMessage& msg)
+uint32_t EngineGlobals::renderModulation() noexcept
 {
-    handleMidiEvent(msg);
+    // PB/MW/AT sources are not wired yet and stay silent
+    lfo1.renderBlock(modSources[1], controlInterval);
+    lfo2.renderBlock(modSources[2], controlInterval);
+    lfo1Value.store(modSources[1][0]);
+    lfo2Value.store(modSources[2][0]);
+
+    // Only the lanes written last time need clearing
+    const uint32_t previousLanes = usedModLanes;
+    for (int d = 0; d < numModDestinations; ++d)
+        if ((previousLanes >> d) & 1u)
+            juce::FloatVectorOperations::clear(modLanes[d], controlInterval);
+
+    usedModLanes = 0;
+    for (int i = 0; i < numModOperations; ++i)
+    {
+        const auto& op = modOperations[(size_t)i];
+        juce::FloatVectorOperations::addWithMultiply(modLanes[op.destination], op.source, op.amount, controlInterval);
+        usedModLanes |= 1u << op.destination;
+    }
+
+    return usedModLanes | previousLanes;
 }
 
-float BaseEngine::getLfoValue(int index) const
+const char* EngineGlobals::getActiveKernelName() const
 {
-    return (index == 0) ? lfo1Value.load() : lfo2Value.load();
+    return Core::Kernels::selectResonatorKernels().name;
 }
 
-void BaseEngine::getModulationValues(float* destination, int count) const
+void EngineGlobals::setPolyphony(int numVoices)
 {
-    if (destination == nullptr || count <= 0) return;
-    
-    // Default modulation values if not overridden
-    for (int i = 0; i < count; ++i) destination[i] = 0.0f;
+    activeVoiceLimit.store(juce::jlimit(1, 32, numVoices));
 }
 
-int BaseEngine::getNumActiveVoices() const
+void EngineGlobals::setRenderThreads(int numThreads)
 {
-    int active = 0;
-    for (auto& voice : voices)
-        if (voice && voice->isActive()) active++;
-    return active;
+    renderPool.setNumLanes(numThreads);
 }
 
-void BaseEngine::setPolyphony(int numVoices)
+bool EngineGlobals::shouldRenderInParallel(int numJobs, int numSamples) const noexcept
 {
-    activeVoiceLimit.store(juce::jlimit(1, 32, numVoices));
+    return renderPool.getNumLanes() > 1
+        && numJobs >= minParallelJobs
+        && numSamples >= minParallelBlockSize;
 }
 
-void BaseEngine::processMidiBuffer(juce::MidiBuffer& midiMessages)
+void EngineGlobals::prepareVoiceScratch(int numVoices, int samplesPerBlock)
 {
-    for (const auto metadata : midiMessages)
+    constexpr int alignFloats = 16; // 64 bytes
+
+    voiceScratchSize = juce::jmax(1, samplesPerBlock);
+    voiceScratchStride = (voiceScratchSize + alignFloats - 1) / alignFloats * alignFloats;
+
+    const auto numStrips = (size_t)numVoices + 1;
+    voiceScratchStorage.calloc(numStrips * (size_t)voiceScratchStride + alignFloats);
+
+    const auto base = reinterpret_cast<uintptr_t>(voiceScratchStorage.get());
+    voiceScratch = reinterpret_cast<float*>((base + 63) & ~uintptr_t(63));
+    mixScratch = voiceScratch + (size_t)numVoices * (size_t)voiceScratchStride;
+}
+
+void EngineGlobals::mixVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                              const int* voiceIndices, int numVoices) noexcept
+{
+    if (numVoices <= 0 || numSamples <= 0)
+        return;
+
+    // Summed in voice order, so the result never depends on which lane rendered what
+    const float* sum = getVoiceScratch(voiceIndices[0]);
+    if (numVoices > 1)
     {
-        handleMidiEvent(metadata.getMessage());
+        juce::FloatVectorOperations::copy(mixScratch, sum, numSamples);
+        for (int i = 1; i < numVoices; ++i)
+            juce::FloatVectorOperations::add(mixScratch, getVoiceScratch(voiceIndices[i]), numSamples);
+        sum = mixScratch;
     }
+
+    // Voices are mono and centred: every channel gets the same sum
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        juce::FloatVectorOperations::add(buffer.getWritePointer(ch, startSample), sum, numSamples);
 }
 
-void BaseEngine::applyGlobalFX(juce::AudioBuffer<float>& buffer)
+void EngineGlobals::applyGlobalFX(juce::AudioBuffer<float>& buffer)
 {
     const int numSamples = buffer.getNumSamples();
 
-    // 1. Process LFOs
-    lfo1Value.store(lfo1.processBlock(numSamples));
-    lfo2Value.store(lfo2.processBlock(numSamples));
-
-    // 2. Global Effects
+    // 1. Global Effects (the LFOs run at control rate, see renderModulation)
     saturation.processBlock(buffer);
     chorus.processBlock(buffer);
     delay.processBlock(buffer);
     reverb.processBlock(buffer);
 
-    // 3. Output Level
+    // 2. Output Level
     masterLevelSmoother.applyGain(buffer, numSamples);
 }
 
@@ -12,51 +12,139 @@
 
 #include "ISynthesisEngine.h"
 #include "IVoice.h"
+#include "ParameterChannel.h"
+#include "VoiceAllocator.h"
+#include "VoiceRenderPool.h"
 #include "Effects/Saturation.h"
 #include "Effects/Delay.h"
 #include "Effects/Chorus.h"
 #include "Effects/Reverb.h"
 #include "CoreModules/LFO.h"
+#include "CoreModules/ModelBank.h"
+#include "CoreModules/MorphCache.h"
+#include "../Common/SpectralModel.h"
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_events/juce_events.h>
-#include <vector>
-#include <memory>
+#include <algorithm>
+#include <array>
 #include <atomic>
 
 namespace NEURONiK::DSP {
 
-class BaseEngine : public ISynthesisEngine
+/**
+ * Voice-independent half of every engine: global FX chain, LFOs and the
+ * global parameter hand-off. Compiled once in BaseEngine.cpp.
+ */
+class EngineGlobals : public ISynthesisEngine
 {
 public:
-    BaseEngine();
-    virtual ~BaseEngine() override = default;
+    ~EngineGlobals() override = default;
 
-    // --- ISynthesisEngine Shared Implementation ---
-    void prepare(double sampleRate, int samplesPerBlock) override;
-    void updateParameters() override;
-    void reset() override;
-    void handleMidiMessage(const juce::MidiMessage& msg) override;
-    
     float getLfoValue(int index) const override;
-    void getModulationValues(float* destination, int count) const override;
-    
-    // Voices management
-    int getNumActiveVoices() const override;
     void setPolyphony(int numVoices) override;
+    const char* getActiveKernelName() const override;
+    void setRenderThreads(int numThreads) override;
+    int getRenderThreads() const override { return renderPool.getNumLanes(); }
+    void setMidiGranularity(int numSamples) override { midiGranularity.store(juce::jlimit(1, maxMidiGranularity, numSamples)); }
+
+    /** Publishes a new global snapshot; picked up at the next updateParameters(). */
+    void setGlobalParams(const GlobalParams& p) override { globalParamChannel.publish(p); }
 
 protected:
+    EngineGlobals() = default;
+
+    void prepareGlobals(double sampleRate, int samplesPerBlock);
+    void updateGlobalParameters();
+    void resetGlobals();
+
+    // --- Modulation ---
+    static constexpr int numModSources = 6;       // Off, LFO 1, LFO 2, PB, MW, AT
+    static constexpr int numModDestinations = 28; // see BaseEngine::applyModulation
+    static constexpr int modLevelDestination = 1;
+    static constexpr int modCutoffDestination = 10;
+
+    /** A compiled mod-matrix route: lane[destination] += source * amount. */
+    struct ModOperation
+    {
+        const float* source;
+        int destination;
+        float amount;
+    };
+
+    /** Flattens the routes of the current block into modOperations. */
+    void compileModMatrix() noexcept;
+
+    /**
+     * Renders one control interval of every source (LFOs at audio rate) and
+     * evaluates the compiled routes into the destination lanes with one vector
+     * multiply-add per route. Returns the lanes written now or at the last tick.
+     */
+    uint32_t renderModulation() noexcept;
+
+    const float* getModulationLane(int destination) const noexcept { return modLanes[destination]; }
+
     /** Subclasses must call this at the end of their renderNextBlock. */
     void applyGlobalFX(juce::AudioBuffer<float>& buffer);
-    
-    /** Subclasses must implement this to route MIDI to their specific voice types. */
-    virtual void handleMidiEvent(const juce::MidiMessage& m) = 0;
-    
-    /** Common MIDI processing loop. */
-    void processMidiBuffer(juce::MidiBuffer& midiMessages);
-
-    std::vector<std::unique_ptr<IVoice>> voices;
+
+    /**
+     * Calls render(jobIndex) for every job. Jobs only write into voice scratch
+     * (see getVoiceScratch), so with more than one render thread they simply run
+     * on the worker pool; the output is identical either way because the voices
+     * are summed afterwards, in voice order, by mixVoices(). Falls back to
+     * rendering inline when the segment is not worth dispatching.
+     *
+     * render must be callable as void(int) noexcept and may only touch the state
+     * and scratch of its own voices.
+     */
+    template <typename RenderJob>
+    void renderJobs(int numJobs, int numSamples, RenderJob& render) noexcept
+    {
+        if (!shouldRenderInParallel(numJobs, numSamples))
+        {
+            for (int j = 0; j < numJobs; ++j)
+                render(j);
+            return;
+        }
+
+        renderPool.run([](void* context, int jobIndex, int) noexcept
+        {
+            (*static_cast<RenderJob*>(context))(jobIndex);
+        }, &render, numJobs);
+    }
+
+    /** Sizes the per-voice scratch for numVoices voices of up to samplesPerBlock samples. */
+    void prepareVoiceScratch(int numVoices, int samplesPerBlock);
+
+    /** Mono render target of a voice: 64-byte aligned, getVoiceScratchSize() samples long. */
+    float* getVoiceScratch(int voiceIndex) const noexcept { return voiceScratch + (size_t)voiceIndex * (size_t)voiceScratchStride; }
+    int getVoiceScratchSize() const noexcept { return voiceScratchSize; }
+
+    /**
+     * Sums the scratch of the listed voices (in list order) and adds the result
+     * to every channel of buffer at startSample.
+     */
+    void mixVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                   const int* voiceIndices, int numVoices) noexcept;
+
     std::atomic<int> activeVoiceLimit { 16 };
 
+    // Fixed control rate: LFOs, the mod matrix and voice parameter latching run
+    // every controlInterval samples, whatever block size the host uses
+    static constexpr int controlInterval = 32;
+    int samplesUntilControlTick = 0;
+    int controlOffset = 0; // position of the segment being rendered inside the control interval
+
+    // Source buffers (index = route source, 0 = Off) and destination lanes, one control interval each
+    alignas(16) float modSources[numModSources][controlInterval] {};
+    alignas(16) float modLanes[numModDestinations][controlInterval] {};
+    std::array<ModOperation, 4> modOperations {};
+    int numModOperations = 0;
+    uint32_t usedModLanes = 0; // bit d = lane d was written at the last tick
+
+    // Events closer than this to the current segment start are applied with it
+    static constexpr int maxMidiGranularity = 1024;
+    std::atomic<int> midiGranularity { 32 };
+
     // Shared FX
     Effects::Saturation saturation;
     Effects::Delay delay;
@@ -69,13 +157,407 @@ protected:
     std::atomic<float> lfo1Value { 0.0f };
     std::atomic<float> lfo2Value { 0.0f };
 
-    GlobalParams pendingGlobalParams;
-    GlobalParams currentGlobalParams;
+    ParameterChannel<GlobalParams> globalParamChannel;
+    GlobalParams blockGlobalParams;   // per-block copy as published
+    GlobalParams currentGlobalParams; // blockGlobalParams plus the modulation of the last control tick
 
     double currentSampleRate = 48000.0;
     int currentSamplesPerBlock = 512;
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BaseEngine)
+    // Parallel voice rendering (opt-in, see setRenderThreads)
+    static constexpr int minParallelJobs = 2;
+    static constexpr int minParallelBlockSize = 32;
+
+    VoiceRenderPool renderPool;
+
+private:
+    bool shouldRenderInParallel(int numJobs, int numSamples) const noexcept;
+
+    // One mono strip per voice plus one for the mixdown, each on its own cache lines
+    juce::HeapBlock<float> voiceScratchStorage;
+    float* voiceScratch = nullptr;
+    float* mixScratch = nullptr;
+    int voiceScratchStride = 0;
+    int voiceScratchSize = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EngineGlobals)
+};
+
+/**
+ * Templated engine core. Owns its voices by value in a contiguous array, so
+ * every per-voice call below resolves statically to VoiceT and can be inlined;
+ * ISynthesisEngine stays the only polymorphic boundary (used by the processor).
+ *
+ * VoiceT must provide a nested Params struct, setParams(const Params*, uint32_t),
+ * setModelBank() plus a static getDefaultModelBank(), setMorphCache(), getPartialAmplitudes() and
+ * the envelope level getters used for visualization, on top of the IVoice interface.
+ */
+template <typename VoiceT, int NumVoices = 32>
+class BaseEngine : public EngineGlobals
+{
+public:
+    using Voice = VoiceT;
+    using VoiceParams = typename VoiceT::Params;
+    static constexpr int maxVoices = NumVoices;
+
+    static_assert(NumVoices <= VoiceAllocator::maxVoices, "VoiceAllocator tracks at most 64 voices");
+
+    BaseEngine()
+    {
+        allocator.reset(NumVoices);
+        prepareVoiceScratch(NumVoices, currentSamplesPerBlock);
+
+        for (auto& voice : voices)
+            voice.setMorphCache(&morphCache);
+    }
+    ~BaseEngine() override = default;
+
+    // --- ISynthesisEngine Shared Implementation ---
+    void prepare(double sampleRate, int samplesPerBlock) override
+    {
+        prepareGlobals(sampleRate, samplesPerBlock);
+        prepareVoiceScratch(NumVoices, samplesPerBlock);
+
+        for (auto& voice : voices)
+            voice.prepare(sampleRate, samplesPerBlock);
+    }
+
+    void updateParameters() override
+    {
+        updateGlobalParameters();
+        latchVoiceParameters();
+
+        // A model load is one pointer swap; the voices only recompute their harmonics
+        const auto* bank = modelBankChannel.acquire();
+        if (bank != currentModelBank)
+        {
+            currentModelBank = bank;
+            morphCache.invalidate(); // a freed bank's address may be reused
+            for (auto& voice : voices)
+                voice.setModelBank(bank);
+        }
+    }
+
+    void reset() override
+    {
+        resetGlobals();
+
+        for (auto& voice : voices)
+            voice.reset();
+
+        allocator.reset(NumVoices);
+    }
+
+    void handleMidiMessage(const juce::MidiMessage& msg) override { handleMidiEvent(msg); }
+
+    int getNumActiveVoices() const override
+    {
+        int active = 0;
+        for (const auto& voice : voices)
+            if (voice.isActive()) active++;
+        return active;
+    }
+
+    void getSpectralData(float* destination64) const override
+    {
+        for (const auto& voice : voices)
+        {
+            if (voice.isActive())
+            {
+                const auto& partials = voice.getPartialAmplitudes();
+                std::copy(partials.begin(), partials.end(), destination64);
+                return;
+            }
+        }
+
+        std::fill(destination64, destination64 + 64, 0.0f);
+    }
+
+    void getEnvelopeLevels(float& amp, float& filter) const override
+    {
+        for (const auto& voice : voices)
+        {
+            if (voice.isActive())
+            {
+                amp = voice.getAmpEnvelopeLevel();
+                filter = voice.getFilterEnvelopeLevel();
+                return;
+            }
+        }
+        amp = 0.0f;
+        filter = 0.0f;
+    }
+
+    void getModulationValues(float* destination, int count) const override
+    {
+        if (destination == nullptr || count <= 0) return;
+
+        int numToCopy = juce::jmin(count, (int)lastModulations.size());
+        for (int i = 0; i < numToCopy; ++i)
+            destination[i] = lastModulations[(size_t)i];
+
+        // Fill remaining with 0
+        for (int i = numToCopy; i < count; ++i)
+            destination[i] = 0.0f;
+    }
+
+    /** Builds a new shared bank on the calling (non-audio) thread and publishes it. */
+    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) override
+    {
+        modelBankChannel.publishModel(model, slot);
+    }
+
+    // --- Specific API ---
+    /** Publishes a new voice snapshot; picked up at the next updateParameters(). */
+    void setVoiceParams(const VoiceParams& p) { voiceParamChannel.publish(p); }
+
+protected:
+    /**
+     * Sample-accurate MIDI: splits the block at event timestamps, applying the
+     * events due at each split and then calling renderSegment(startSample, numSamples)
+     * up to the next one. Every event gets its own split at its exact timestamp;
+     * only events within midiGranularity samples after a split are pulled forward
+     * into it, so dense MIDI does not shatter the block.
+     * Segments also end at every control tick (see controlTick), and never exceed
+     * the voice scratch, even if the host sends more samples than it announced
+     * in prepare().
+     */
+    template <typename RenderSegment>
+    void renderWithMidi(juce::MidiBuffer& midiMessages, int numSamples, RenderSegment&& renderSegment)
+    {
+        const int granularity = midiGranularity.load(std::memory_order_relaxed);
+        const int maxSegment = getVoiceScratchSize();
+
+        auto event = midiMessages.begin();
+        const auto lastEvent = midiMessages.end();
+        int position = 0;
+
+        while (position < numSamples)
+        {
+            if (samplesUntilControlTick <= 0)
+            {
+                controlTick();
+                samplesUntilControlTick = controlInterval;
+            }
+
+            // Only an event due right here pulls its neighbours forward; block
+            // starts and control ticks must not quantize an isolated event
+            const bool eventSplit = event != lastEvent && (*event).samplePosition <= position;
+            const int windowEnd = position + (eventSplit ? granularity : 1);
+            if (eventSplit)
+                reclaimFinishedVoices();
+
+            for (; event != lastEvent && (*event).samplePosition < windowEnd; ++event)
+                handleMidiEvent((*event).getMessage());
+
+            const int eventEnd = (event != lastEvent) ? juce::jmin(numSamples, (*event).samplePosition)
+                                                      : numSamples;
+            const int segmentEnd = juce::jmin(eventEnd, position + samplesUntilControlTick);
+
+            for (int start = position; start < segmentEnd; start += maxSegment)
+            {
+                controlOffset = controlInterval - samplesUntilControlTick + (start - position);
+                renderSegment(start, juce::jmin(maxSegment, segmentEnd - start));
+            }
+
+            samplesUntilControlTick -= segmentEnd - position;
+            position = segmentEnd;
+        }
+
+        // Events stamped past the end of the block still take effect
+        for (; event != lastEvent; ++event)
+            handleMidiEvent((*event).getMessage());
+    }
+
+    void handleMidiEvent(const juce::MidiMessage& m)
+    {
+        const int channel = m.getChannel();
+
+        if (m.isNoteOn())
+        {
+            startNote(channel, m.getNoteNumber(), m.getFloatVelocity());
+        }
+        else if (m.isNoteOff())
+        {
+            const int v = allocator.noteReleased(channel, m.getNoteNumber());
+            if (v != VoiceAllocator::noVoice)
+                voices[(size_t)v].noteOff(m.getFloatVelocity(), true);
+        }
+        else if (m.isPitchWheel())
+        {
+            float bendSemitones = ((float)m.getPitchWheelValue() - 8192.0f) / 8192.0f * 48.0f; // Scale to 48 semitones
+            forEachVoiceOnChannel(channel, [&](VoiceT& v) { v.notePitchBend(bendSemitones); });
+        }
+        else if (m.isAftertouch() || m.isChannelPressure())
+        {
+            float pressureVal = m.isAftertouch() ? (float)m.getAfterTouchValue() : (float)m.getChannelPressureValue();
+            float pressure = pressureVal / 127.0f;
+            forEachVoiceOnChannel(channel, [&](VoiceT& v) { v.notePressure(pressure); });
+        }
+        else if (m.isController() && m.getControllerNumber() == 74)
+        {
+            float timbre = (float)m.getControllerValue() / 127.0f;
+            forEachVoiceOnChannel(channel, [&](VoiceT& v) { v.noteTimbre(timbre); });
+        }
+    }
+
+    void startNote(int channel, int note, float velocity)
+    {
+        // The same key again: let the previous instance ring out as a released note
+        const int previous = allocator.noteReleased(channel, note);
+        if (previous != VoiceAllocator::noVoice)
+            voices[(size_t)previous].noteOff(0.0f, true);
+
+        // Over the limit: fade out the oldest released (else oldest held) voice
+        const int limit = juce::jlimit(1, NumVoices, activeVoiceLimit.load());
+        while (allocator.getNumSounding() >= limit)
+        {
+            const int victim = allocator.chooseVictim();
+            allocator.markStolen(victim);
+            voices[(size_t)victim].fastRelease();
+        }
+
+        bool wasStolen = false;
+        const int v = allocator.takeVoice(wasStolen);
+        if (v == VoiceAllocator::noVoice)
+            return;
+
+        auto& voice = voices[(size_t)v];
+        if (wasStolen)
+            voice.reset(); // no spare voice left for the fade-out
+
+        voice.setChannel(channel);
+        voice.noteOn(note, velocity);
+        allocator.noteStarted(v, channel, note);
+
+        // A note starting mid-interval needs its resonator before the next tick;
+        // the smoothers only advance at ticks
+        voice.controlTick(0);
+    }
+
+    /** Channel 1 addresses every voice (MPE master channel / plain MIDI). */
+    template <typename Fn>
+    void forEachVoiceOnChannel(int channel, Fn&& fn)
+    {
+        const uint64_t mask = (channel == 1) ? allocator.getBusyMask() : allocator.getChannelMask(channel);
+        VoiceAllocator::forEachVoice(mask, [&](int v) { fn(voices[(size_t)v]); });
+    }
+
+    /** Hands voices that fell silent back to the allocator (O(busy voices)). */
+    void reclaimFinishedVoices()
+    {
+        VoiceAllocator::forEachVoice(allocator.getBusyMask(), [this](int v)
+        {
+            if (!voices[(size_t)v].isActive())
+                allocator.voiceFinished(v);
+        });
+    }
+
+    /** Copies the newest voice snapshot pointer into every voice and lets them re-latch. */
+    void latchVoiceParameters()
+    {
+        const auto& snapshot = voiceParamChannel.acquire();
+        for (auto& voice : voices)
+        {
+            voice.setParams(&snapshot.value, snapshot.version);
+            voice.updateParameters();
+        }
+    }
+
+    /**
+     * One control-rate step: start a fresh morph cache, re-latch voice parameters
+     * (envelopes, smoother targets), re-evaluate the modulation and let every voice
+     * re-derive its resonator amplitudes/coefficients. All segments up to the next
+     * tick reuse them, so the result does not depend on the host block size.
+     */
+    void controlTick()
+    {
+        morphCache.invalidate();
+        latchVoiceParameters();
+        applyModulation();
+
+        for (auto& voice : voices)
+            voice.controlTick(controlInterval);
+    }
+
+    /** Points a voice about to render the current segment at its audio-rate lanes. */
+    void bindModulationLanes(VoiceT& voice) const noexcept
+    {
+        voice.setModulationLanes(getModulationLane(modLevelDestination) + controlOffset,
+                                 getModulationLane(modCutoffDestination) + controlOffset);
+    }
+
+    /**
+     * Evaluates the mod matrix for the next control interval. Level and cutoff
+     * are read per sample from their lanes (see bindModulationLanes); every other
+     * destination is latched once per tick from the first sample of its lane.
+     */
+    void applyModulation()
+    {
+        const uint32_t lanes = renderModulation();
+
+        // Global destinations are re-derived from the block values at every tick
+        currentGlobalParams = blockGlobalParams;
+
+        // Lanes dropped since the last tick were cleared, so they hand out 0 here
+        for (int d = 0; d < numModDestinations; ++d)
+        {
+            if (((lanes >> d) & 1u) == 0)
+                continue;
+
+            const float value = getModulationLane(d)[0];
+            lastModulations[(size_t)d] = value;
+            setModulation(d, value);
+        }
+    }
+
+    void setModulation(int destination, float value) noexcept
+    {
+        switch (destination)
+        {
+            case 1: for (auto& v : voices) v.modLevel = value; break;
+            case 2: for (auto& v : voices) v.modInharmonicity = value; break;
+            case 3: for (auto& v : voices) v.modRoughness = value; break;
+            case 4: for (auto& v : voices) v.modMorphX = value; break;
+            case 5: for (auto& v : voices) v.modMorphY = value; break;
+            case 6: for (auto& v : voices) v.modAmpAttack = value; break;
+            case 7: for (auto& v : voices) v.modAmpDecay = value; break;
+            case 8: for (auto& v : voices) v.modAmpSustain = value; break;
+            case 9: for (auto& v : voices) v.modAmpRelease = value; break;
+            case 10: for (auto& v : voices) v.modCutoff = value * IVoice::cutoffModRangeHz; break;
+            case 11: for (auto& v : voices) v.modFilterRes = value; break;
+            // 12-16 Filter Env params (pending IVoice members)
+            case 17: currentGlobalParams.saturationAmt += value; break;
+            case 18: currentGlobalParams.delayTime += value; break;
+            case 19: currentGlobalParams.delayFB += value; break;
+            case 20: for (auto& v : voices) v.modParity = value; break;
+            case 21: for (auto& v : voices) v.modShift = value; break;
+            case 22: for (auto& v : voices) v.modRolloff = value; break;
+            case 23: for (auto& v : voices) v.modExciteNoise = value; break;
+            case 24: for (auto& v : voices) v.modExciteColor = value; break;
+            case 25: for (auto& v : voices) v.modImpulseMix = value; break;
+            case 26: for (auto& v : voices) v.modResonance = value; break;
+            case 27: for (auto& v : voices) v.modUnison = value; break;
+            default: break;
+        }
+    }
+
+    std::array<VoiceT, NumVoices> voices;
+    VoiceAllocator allocator;
+
+    // Voices read the acquired snapshot by pointer (see VoiceT::setParams)
+    ParameterChannel<VoiceParams> voiceParamChannel;
+
+    // All voices share one immutable bank; replaced banks are freed off the audio thread
+    Core::ModelBankChannel modelBankChannel { VoiceT::getDefaultModelBank() };
+    const Core::ModelBank* currentModelBank = nullptr;
+
+    // Morphed spectra shared by the voices within one control tick
+    Core::MorphCache morphCache;
+
+    std::array<float, 64> lastModulations {};
+
+    JUCE_DECLARE_NON_COPYABLE(BaseEngine)
 };
 
 } // namespace NEURONiK::DSP
@@ -9,6 +9,7 @@
 */
 
 #include "Envelope.h"
+#include <algorithm>
 #include <cmath>
 
 namespace NEURONiK::DSP::Core {
@@ -30,25 +31,25 @@ void Envelope::setSampleRate(double newSampleRate) noexcept
 
 void Envelope::setAttackTime(float ms) noexcept
 {
-    attackTimeMs_.store(juce::jmax(0.1f, ms), std::memory_order_release);
-    parametersDirty_.store(true, std::memory_order_release);
+    attackTimeMs_ = juce::jmax(0.1f, ms);
+    parametersDirty_ = true;
 }
 
 void Envelope::setDecayTime(float ms) noexcept
 {
-    decayTimeMs_.store(juce::jmax(0.1f, ms), std::memory_order_release);
-    parametersDirty_.store(true, std::memory_order_release);
+    decayTimeMs_ = juce::jmax(0.1f, ms);
+    parametersDirty_ = true;
 }
 
 void Envelope::setSustainLevel(float level) noexcept
 {
-    sustainLevel_.store(juce::jlimit(0.0f, 1.0f, level), std::memory_order_release);
+    sustainLevel_ = juce::jlimit(0.0f, 1.0f, level);
 }
 
 void Envelope::setReleaseTime(float ms) noexcept
 {
-    releaseTimeMs_.store(juce::jmax(0.1f, ms), std::memory_order_release);
-    parametersDirty_.store(true, std::memory_order_release);
+    releaseTimeMs_ = juce::jmax(0.1f, ms);
+    parametersDirty_ = true;
 }
 
 void Envelope::setParameters(float attack, float decay, float sustain, float release) noexcept
@@ -61,13 +62,24 @@ void Envelope::setParameters(float attack, float decay, float sustain, float rel
 
 void Envelope::noteOn() noexcept
 {
-    updateMultipliers(); // Ensure we have latest values
+    latchParameters(); // Ensure we have latest values
+    fastReleaseActive_ = false;
     currentState_ = State::Attack;
 }
 
 void Envelope::noteOff() noexcept
 {
-    updateMultipliers(); 
+    latchParameters();
+    fastReleaseActive_ = false;
+    currentState_ = State::Release;
+}
+
+void Envelope::fastRelease() noexcept
+{
+    if (currentState_ == State::Idle)
+        return;
+
+    fastReleaseActive_ = true;
     currentState_ = State::Release;
 }
 
@@ -75,18 +87,14 @@ void Envelope::reset() noexcept
 {
     currentState_ = State::Idle;
     currentLevel_ = 0.0f;
+    fastReleaseActive_ = false;
 }
 
 float Envelope::processSample() noexcept
 {
-    // Check if parameters changed
-    if (parametersDirty_.load(std::memory_order_acquire))
-    {
-        updateMultipliers();
-        parametersDirty_.store(false, std::memory_order_release);
-    }
+    latchParameters();
 
-    float sustain = sustainLevel_.load(std::memory_order_acquire);
+    const float sustain = sustainLevel_;
 
     switch (currentState_)
     {
@@ -121,7 +129,7 @@ float Envelope::processSample() noexcept
             break;
 
         case State::Release:
-            currentLevel_ = releaseMult_ * currentLevel_;
+            currentLevel_ = (fastReleaseActive_ ? fastReleaseMult_ : releaseMult_) * currentLevel_;
             
             if (currentLevel_ < RELEASE_TARGET)
             {
@@ -134,11 +142,147 @@ float Envelope::processSample() noexcept
     return currentLevel_;
 }
 
+void Envelope::processBlock(float* out, int numSamples) noexcept
+{
+    latchParameters();
+
+    const float sustain = sustainLevel_;
+    int i = 0;
+
+    while (i < numSamples)
+    {
+        const int remaining = numSamples - i;
+
+        switch (currentState_)
+        {
+            case State::Idle:
+                currentLevel_ = 0.0f;
+                std::fill(out + i, out + numSamples, 0.0f);
+                i = numSamples;
+                break;
+
+            case State::Sustain:
+                currentLevel_ = sustain;
+                std::fill(out + i, out + numSamples, sustain);
+                i = numSamples;
+                break;
+
+            case State::Attack:
+            {
+                // Reaches 1.0 once (TARGET - level) * mult^n <= TARGET - 1
+                const int n = samplesUntilWithin(currentLevel_, ATTACK_TARGET, attackMult_, ATTACK_TARGET - 1.0f, remaining);
+                if (n > remaining)
+                {
+                    renderExponential(out + i, remaining, currentLevel_, ATTACK_TARGET, attackMult_);
+                    i = numSamples;
+                }
+                else
+                {
+                    renderExponential(out + i, n - 1, currentLevel_, ATTACK_TARGET, attackMult_);
+                    i += n - 1;
+                    currentLevel_ = 1.0f;
+                    out[i++] = currentLevel_;
+                    currentState_ = State::Decay;
+                }
+                break;
+            }
+
+            case State::Decay:
+            {
+                const int n = samplesUntilWithin(currentLevel_, sustain, decayMult_, 0.001f, remaining);
+                if (n > remaining)
+                {
+                    renderExponential(out + i, remaining, currentLevel_, sustain, decayMult_);
+                    i = numSamples;
+                }
+                else
+                {
+                    renderExponential(out + i, n - 1, currentLevel_, sustain, decayMult_);
+                    i += n - 1;
+                    currentLevel_ = sustain;
+                    out[i++] = currentLevel_;
+                    currentState_ = State::Sustain;
+                }
+                break;
+            }
+
+            case State::Release:
+            {
+                const float mult = fastReleaseActive_ ? fastReleaseMult_ : releaseMult_;
+                const int n = samplesUntilWithin(currentLevel_, 0.0f, mult, RELEASE_TARGET, remaining);
+                if (n > remaining)
+                {
+                    renderExponential(out + i, remaining, currentLevel_, 0.0f, mult);
+                    i = numSamples;
+                }
+                else
+                {
+                    renderExponential(out + i, n - 1, currentLevel_, 0.0f, mult);
+                    i += n - 1;
+                    currentLevel_ = 0.0f;
+                    out[i++] = currentLevel_;
+                    currentState_ = State::Idle;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void Envelope::renderExponential(float* out, int numSamples, float& level, float target, float mult) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    // Four powers of the multiplier side by side; the distance to the target
+    // advances by mult^4 per step, so the inner loop has no dependency chain
+    const float m2 = mult * mult;
+    const float powers[4] = { mult, m2, m2 * mult, m2 * m2 };
+    const float step = powers[3];
+    float delta = level - target;
+
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4)
+    {
+        for (int k = 0; k < 4; ++k)
+            out[i + k] = target + delta * powers[k];
+        delta *= step;
+    }
+
+    for (int k = 0; i < numSamples; ++i, ++k)
+        out[i] = target + delta * powers[k];
+
+    level = out[numSamples - 1];
+}
+
+int Envelope::samplesUntilWithin(float level, float target, float mult, float threshold, int limit) noexcept
+{
+    const float distance = std::abs(level - target);
+    if (distance <= threshold || mult <= 0.0f)
+        return 1;
+    if (mult >= 1.0f)
+        return limit + 1;
+
+    // distance * mult^n <= threshold  <=>  n >= log(threshold / distance) / log(mult)
+    const float n = std::ceil(std::log(threshold / distance) / std::log(mult));
+    return n > (float)limit ? limit + 1 : juce::jmax(1, (int)n);
+}
+
+void Envelope::latchParameters() noexcept
+{
+    if (parametersDirty_)
+    {
+        updateMultipliers();
+        parametersDirty_ = false;
+    }
+}
+
 void Envelope::updateMultipliers() noexcept
 {
-    attackMult_ = calculateMultiplier(attackTimeMs_.load(std::memory_order_acquire));
-    decayMult_ = calculateMultiplier(decayTimeMs_.load(std::memory_order_acquire));
-    releaseMult_ = calculateMultiplier(releaseTimeMs_.load(std::memory_order_acquire));
+    attackMult_ = calculateMultiplier(attackTimeMs_);
+    decayMult_ = calculateMultiplier(decayTimeMs_);
+    releaseMult_ = calculateMultiplier(releaseTimeMs_);
+    fastReleaseMult_ = calculateMultiplier(FAST_RELEASE_MS);
 }
 
 float Envelope::calculateMultiplier(float ms) const noexcept
@@ -11,7 +11,6 @@
 #pragma once
 
 #include <juce_core/juce_core.h>
-#include <atomic>
 
 namespace NEURONiK::DSP::Core {
 
@@ -21,10 +20,12 @@ namespace NEURONiK::DSP::Core {
  *
  * Uses a recursive exponential formula: y = y * multiplier + target
  * This provides natural-sounding curves with very low CPU cost and zero allocations.
+ * processBlock renders the same curves in closed form, target + (y0 - target) * m^n,
+ * one stage at a time, so the block only splits at stage transitions.
  *
  * Thread-Safety:
- * - setParameters: Thread-safe (atomic).
- * - processSample: Real-time safe. Must be called from Audio Thread.
+ * - Audio Thread only. Parameter changes are latched at the start of the next
+ *   processBlock / processSample (control rate), not per sample.
  */
 class Envelope
 {
@@ -44,21 +45,26 @@ public:
     // --- Configuration ---
     void setSampleRate(double newSampleRate) noexcept;
 
-    // --- Parameters (Thread-safe) ---
+    // --- Parameters ---
     void setAttackTime(float ms) noexcept;
     void setDecayTime(float ms) noexcept;
     void setSustainLevel(float level) noexcept; // 0.0 to 1.0
     void setReleaseTime(float ms) noexcept;
-    // New: set all ADSR parameters at once (thread‑safe)
+    // Set all ADSR parameters at once
     void setParameters(float attack, float decay, float sustain, float release) noexcept;
 
     // --- Control ---
     void noteOn() noexcept;
     void noteOff() noexcept;
+    /** Releases with a fixed ~10 ms exponential fade regardless of the release time (voice stealing). */
+    void fastRelease() noexcept;
     void reset() noexcept;
 
     // --- Processing ---
     float processSample() noexcept;
+
+    /** Renders numSamples envelope values into out (overwriting it); same curve as processSample. */
+    void processBlock(float* out, int numSamples) noexcept;
     
     bool isActive() const noexcept { return currentState_ != State::Idle; }
     State getCurrentState() const noexcept { return currentState_; }
@@ -68,6 +74,16 @@ private:
     // --- Internal Logic ---
     void updateMultipliers() noexcept;
     float calculateMultiplier(float ms) const noexcept;
+    void latchParameters() noexcept;
+
+    /**
+     * Writes target + (level - target) * mult^(k+1) for k in [0, numSamples) and
+     * leaves level at the last value written.
+     */
+    static void renderExponential(float* out, int numSamples, float& level, float target, float mult) noexcept;
+
+    /** Samples n until target + (level - target) * mult^n is within threshold of target: at least 1, limit + 1 if beyond limit. */
+    static int samplesUntilWithin(float level, float target, float mult, float threshold, int limit) noexcept;
 
     // --- State ---
     State currentState_ = State::Idle;
@@ -78,19 +94,22 @@ private:
     float attackMult_ = 0.0f;
     float decayMult_ = 0.0f;
     float releaseMult_ = 0.0f;
+    float fastReleaseMult_ = 0.0f;
+    bool fastReleaseActive_ = false;
 
-    // --- Parameters (Atomics for thread safety) ---
-    std::atomic<float> attackTimeMs_{ 10.0f };
-    std::atomic<float> decayTimeMs_{ 100.0f };
-    std::atomic<float> sustainLevel_{ 0.7f };
-    std::atomic<float> releaseTimeMs_{ 200.0f };
-    std::atomic<bool> parametersDirty_{ true };
+    // --- Parameters (latched into the multipliers at control rate) ---
+    float attackTimeMs_ = 10.0f;
+    float decayTimeMs_ = 100.0f;
+    float sustainLevel_ = 0.7f;
+    float releaseTimeMs_ = 200.0f;
+    bool parametersDirty_ = true;
 
     // Targets for exponential curves
     // To reach 1.0 exponentially, we target slightly above 1.0 (e.g. 1.1) 
     // and clip at 1.0 to avoid infinite tail.
     static constexpr float ATTACK_TARGET = 1.1f;
     static constexpr float RELEASE_TARGET = 0.0001f; // Target near zero
+    static constexpr float FAST_RELEASE_MS = 1.0f;    // time constant: full scale to RELEASE_TARGET in ~9 ms
 };
 
 } // namespace NEURONiK::DSP::Core
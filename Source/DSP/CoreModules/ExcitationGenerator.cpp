@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    ExcitationGenerator.cpp
+    Created: 16 Oct 2026
+    Description: Implementation of the block-rate Neurotik exciter.
+
+  ==============================================================================
+*/
+
+#include "ExcitationGenerator.h"
+
+namespace NEURONiK::DSP::Core {
+
+ExcitationGenerator::ExcitationGenerator() noexcept
+{
+    // Independent, non-zero seeds per lane (and per voice)
+    auto& random = juce::Random::getSystemRandom();
+    alignas(16) uint32_t seeds[4];
+    for (auto& seed : seeds)
+    {
+        seed = (uint32_t)random.nextInt();
+        if (seed == 0)
+            seed = 0x6d2b79f5u;
+    }
+    noiseState = _mm_load_si128((const __m128i*) seeds);
+
+    setParameters(0.5f, 1.0f, 0.0f);
+    reset();
+}
+
+void ExcitationGenerator::setParameters(float color, float amount, float impulseMix) noexcept
+{
+    const float a = juce::jlimit(0.01f, 0.99f, color);
+    const float b = 1.0f - a;
+    const float level = juce::jlimit(0.0f, 1.0f, amount);
+
+    column0 = _mm_setr_ps(a, a * b, a * b * b, a * b * b * b);
+    column1 = _mm_setr_ps(0.0f, a, a * b, a * b * b);
+    column2 = _mm_setr_ps(0.0f, 0.0f, a, a * b);
+    column3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, a);
+    feedback = _mm_setr_ps(b, b * b, b * b * b, b * b * b * b);
+
+    noiseGain = (1.0f - impulseMix) * level;
+    impulseGain = impulseMix * level;
+}
+
+void ExcitationGenerator::reset() noexcept
+{
+    lastOutput = _mm_setzero_ps();
+    impulsePending = false;
+}
+
+void ExcitationGenerator::process(float* out, int numSamples) noexcept
+{
+    // Work on local copies: stores to out may alias the members, which would
+    // otherwise be reloaded every step
+    __m128i state = noiseState;
+    __m128 previous = lastOutput;
+    const __m128 c0 = column0, c1 = column1, c2 = column2, c3 = column3, fb = feedback;
+
+    // The state as a signed integer, scaled to [-1, 1)
+    const __m128 toBipolar = _mm_set1_ps(1.0f / 2147483648.0f);
+    const __m128 gain = _mm_set1_ps(noiseGain);
+
+    // Four new white samples through the colour filter. The input part does not
+    // depend on the previous output, so only one multiply-add per four samples
+    // sits on the recursive path.
+    auto nextFour = [&]() noexcept
+    {
+        state = _mm_xor_si128(state, _mm_slli_epi32(state, 13));
+        state = _mm_xor_si128(state, _mm_srli_epi32(state, 17));
+        state = _mm_xor_si128(state, _mm_slli_epi32(state, 5));
+        const __m128 white = _mm_mul_ps(_mm_cvtepi32_ps(state), toBipolar);
+
+        const __m128 x01 = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(white, white, _MM_SHUFFLE(0, 0, 0, 0))),
+                                      _mm_mul_ps(c1, _mm_shuffle_ps(white, white, _MM_SHUFFLE(1, 1, 1, 1))));
+        const __m128 x23 = _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(white, white, _MM_SHUFFLE(2, 2, 2, 2))),
+                                      _mm_mul_ps(c3, _mm_shuffle_ps(white, white, _MM_SHUFFLE(3, 3, 3, 3))));
+        const __m128 y = _mm_add_ps(_mm_mul_ps(fb, previous), _mm_add_ps(x01, x23));
+
+        previous = _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 3, 3, 3));
+        return y;
+    };
+
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4)
+        _mm_storeu_ps(&out[i], _mm_mul_ps(nextFour(), gain));
+
+    if (i < numSamples)
+    {
+        // Tail: filter four samples, keep the state after the last one used
+        alignas(16) float y[4];
+        _mm_store_ps(y, nextFour());
+
+        const int remaining = numSamples - i;
+        for (int k = 0; k < remaining; ++k)
+            out[i + k] = y[k] * noiseGain;
+
+        previous = _mm_set1_ps(y[remaining - 1]);
+    }
+
+    noiseState = state;
+    lastOutput = previous;
+
+    if (impulsePending && numSamples > 0)
+    {
+        out[0] += impulseGain;
+        impulsePending = false;
+    }
+}
+
+} // namespace NEURONiK::DSP::Core
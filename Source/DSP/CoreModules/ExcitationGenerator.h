@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    ExcitationGenerator.h
+    Created: 16 Oct 2026
+    Description: Block-rate noise/impulse exciter for the Neurotik resonator bank.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <immintrin.h>
+#include <cstdint>
+
+namespace NEURONiK::DSP::Core {
+
+/**
+ * Coloured noise plus a one-shot impulse, rendered a block at a time:
+ * - four xorshift32 generators side by side (one per SSE lane),
+ * - the one-pole colour filter run four samples per step in closed form,
+ * - the noise/impulse mix folded into one gain, with every clamp done in
+ *   setParameters() (control rate) instead of per sample.
+ *
+ * Thread-Safety:
+ * - Audio Thread only.
+ */
+class ExcitationGenerator
+{
+public:
+    ExcitationGenerator() noexcept;
+    ~ExcitationGenerator() = default;
+
+    /**
+     * @param color       one-pole coefficient, 0 (dark) to 1 (white); clamped to 0.01..0.99
+     * @param amount      overall excitation level, clamped to 0..1
+     * @param impulseMix  0 = noise only, 1 = impulse only
+     */
+    void setParameters(float color, float amount, float impulseMix) noexcept;
+
+    /** Adds a unit impulse (times the impulse gain) at the start of the next block. */
+    void triggerImpulse() noexcept { impulsePending = true; }
+
+    /** Overwrites out[0..numSamples) with the excitation signal. */
+    void process(float* out, int numSamples) noexcept;
+
+    void reset() noexcept;
+
+private:
+    __m128i noiseState;
+
+    // y[n] = a x[n] + (1 - a) y[n-1], unrolled over four samples: column k holds
+    // the contribution of x[n+k] to y[n..n+3], feedback that of y[n-1]
+    __m128 column0, column1, column2, column3, feedback;
+    __m128 lastOutput; // y[n-1] in every lane
+
+    float noiseGain = 1.0f;
+    float impulseGain = 0.0f;
+    bool impulsePending = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ExcitationGenerator)
+};
+
+} // namespace NEURONiK::DSP::Core
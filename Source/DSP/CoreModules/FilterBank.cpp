@@ -14,6 +14,13 @@
 
 namespace NEURONiK::DSP::Core {
 
+// Mapping 0.0 - 1.0 to a musical Q range (0.5 to 15.0)
+// Quadratic curve for better resolution at low resonance
+static inline float mapResonanceToQ(float r) noexcept
+{
+    return 0.5f + (r * r * 14.5f);
+}
+
 FilterBank::FilterBank() noexcept
 {
     reset();
@@ -38,11 +45,7 @@ void FilterBank::setCutoff(float frequencyHz) noexcept
 void FilterBank::setResonance(float q) noexcept
 {
     float validatedQ = validateAudioParam(q, 0.0f, 1.0f, 0.5f, "FilterBank resonance (q input)");
-    
-    // Mapping 0.0 - 1.0 to a musical Q range (0.5 to 15.0)
-    // Quadratic curve for better resolution at low resonance
-    float mappedQ = 0.5f + (validatedQ * validatedQ * 14.5f); 
-    resonance_.store(mappedQ, std::memory_order_release);
+    resonance_.store(mapResonanceToQ(validatedQ), std::memory_order_release);
     coefficientsDirty_.store(true, std::memory_order_release);
 }
 
@@ -52,10 +55,34 @@ void FilterBank::setType(FilterType newType) noexcept
     coefficientsDirty_.store(true, std::memory_order_release);
 }
 
+void FilterBank::setTopology(Topology newTopology) noexcept
+{
+    topology_.store(newTopology, std::memory_order_release);
+    coefficientsDirty_.store(true, std::memory_order_release);
+}
+
+void FilterBank::setModulatedParameters(float cutoffHz, float resonance) noexcept
+{
+    // No validation logging or atomics here: this runs once per sample per voice
+    const float newCutoff = std::isfinite(cutoffHz) ? juce::jlimit(20.0f, 20000.0f, cutoffHz) : 1000.0f;
+    const float newQ = mapResonanceToQ(std::isfinite(resonance) ? juce::jlimit(0.0f, 1.0f, resonance) : 0.5f);
+
+    // A steady target costs nothing: only a change schedules new coefficients
+    if (hasModulation_ && newCutoff == modCutoffHz_ && newQ == modQ_)
+        return;
+
+    modCutoffHz_ = newCutoff;
+    modQ_ = newQ;
+    hasModulation_ = true;
+    modulationPending_ = true;
+}
+
 void FilterBank::reset() noexcept
 {
     z1_ = 0.0f;
     z2_ = 0.0f;
+    ic1eq_ = 0.0f;
+    ic2eq_ = 0.0f;
 }
 
 float FilterBank::processSample(float input) noexcept
@@ -63,6 +90,17 @@ float FilterBank::processSample(float input) noexcept
     if (coefficientsDirty_.load(std::memory_order_acquire))
         updateCoefficients();
 
+    if (activeTopology_ == Topology::StateVariable)
+        return processStateVariable(input);
+
+    // Modulated biquad: recompute at control rate only (no interpolation)
+    if (modulationPending_ && --samplesUntilUpdate_ <= 0)
+    {
+        samplesUntilUpdate_ = modulationInterval;
+        modulationPending_ = false;
+        updateBiquadCoefficients(getTargetCutoff(), getTargetQ());
+    }
+
     // Direct Form II Transposed implementation:
     // y[n] = b0*x[n] + z1[n-1]
     // z1[n] = b1*x[n] - a1*y[n] + z2[n-1]
@@ -75,11 +113,94 @@ float FilterBank::processSample(float input) noexcept
     return output;
 }
 
+float FilterBank::processStateVariable(float input) noexcept
+{
+    if (--samplesUntilUpdate_ <= 0)
+    {
+        if (modulationPending_)
+        {
+            updateStateVariableTargets(false);
+        }
+        else if (gStep_ != 0.0f || kStep_ != 0.0f)
+        {
+            // The ramp has arrived: hold the exact target until the next change
+            g_ = gTarget_;
+            k_ = kTarget_;
+            gStep_ = 0.0f;
+            kStep_ = 0.0f;
+        }
+    }
+
+    g_ += gStep_;
+    k_ += kStep_;
+
+    // TPT SVF (Zavalishin / Simper): only a division per sample, no trig
+    const float a1 = 1.0f / (1.0f + g_ * (g_ + k_));
+    const float a2 = g_ * a1;
+    const float a3 = g_ * a2;
+
+    const float v3 = input - ic2eq_;
+    const float v1 = a1 * ic1eq_ + a2 * v3;
+    const float v2 = ic2eq_ + a2 * ic1eq_ + a3 * v3;
+    ic1eq_ = 2.0f * v1 - ic1eq_;
+    ic2eq_ = 2.0f * v2 - ic2eq_;
+
+    switch (activeType_)
+    {
+        case FilterType::LowPass:  return v2;
+        case FilterType::HighPass: return input - k_ * v1 - v2;
+        case FilterType::BandPass: return k_ * v1; // unity peak gain, like the RBJ band-pass
+        case FilterType::Notch:    return input - k_ * v1;
+    }
+
+    return v2;
+}
+
+void FilterBank::updateStateVariableTargets(bool snap) noexcept
+{
+    samplesUntilUpdate_ = modulationInterval;
+    modulationPending_ = false;
+
+    // Prewarped integrator gain; keep the cutoff below Nyquist so tan() stays finite
+    const float nyquistLimit = static_cast<float>(sampleRate_) * 0.49f;
+    const float f = juce::jmin(getTargetCutoff(), nyquistLimit);
+    gTarget_ = std::tan(juce::MathConstants<float>::pi * f / static_cast<float>(sampleRate_));
+    kTarget_ = 1.0f / getTargetQ();
+
+    if (snap)
+    {
+        g_ = gTarget_;
+        k_ = kTarget_;
+        gStep_ = 0.0f;
+        kStep_ = 0.0f;
+    }
+    else
+    {
+        // Linear ramp towards the new target over the next interval
+        constexpr float invInterval = 1.0f / static_cast<float>(modulationInterval);
+        gStep_ = (gTarget_ - g_) * invInterval;
+        kStep_ = (kTarget_ - k_) * invInterval;
+    }
+}
+
 void FilterBank::updateCoefficients() noexcept
 {
-    float f = cutoffHz_.load(std::memory_order_acquire);
-    float q = resonance_.load(std::memory_order_acquire);
-    FilterType t = type_.load(std::memory_order_acquire);
+    activeTopology_ = topology_.load(std::memory_order_acquire);
+    activeType_ = type_.load(std::memory_order_acquire);
+    baseCutoffHz_ = cutoffHz_.load(std::memory_order_acquire);
+    baseQ_ = resonance_.load(std::memory_order_acquire);
+
+    if (activeTopology_ == Topology::StateVariable)
+        updateStateVariableTargets(true);
+    else
+        updateBiquadCoefficients(getTargetCutoff(), getTargetQ());
+
+    coefficientsDirty_.store(false, std::memory_order_release);
+}
+
+void FilterBank::updateBiquadCoefficients(float f, float q) noexcept
+{
+    const FilterType t = activeType_;
 
     // RBJ Biquad Calculations
     float omega = juce::MathConstants<float>::twoPi * f / static_cast<float>(sampleRate_);
@@ -138,8 +259,6 @@ void FilterBank::updateCoefficients() noexcept
         a1_ *= invA0;
         a2_ *= invA0;
     }
-
-    coefficientsDirty_.store(false, std::memory_order_release);
 }
 
 } // namespace NEURONiK::DSP::Core
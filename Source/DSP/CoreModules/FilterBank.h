@@ -20,10 +20,18 @@ namespace NEURONiK::DSP::Core {
  * @class FilterBank
  * @brief core filter module supporting LowPass, HighPass, BandPass, and Notch.
  * 
- * Uses a Direct Form II Transposed biquad implementation.
+ * Two topologies are available:
+ * - Biquad: Direct Form II Transposed RBJ biquad (default).
+ * - StateVariable: TPT (zero-delay feedback) SVF. It stays well behaved when
+ *   its coefficients move every sample, so it is the one to use for envelope
+ *   and mod-matrix driven cutoff.
  *
  * Thread-Safety:
- * - setCutoff/setResonance/setType: Thread-safe (atomic).
+ * - setCutoff/setResonance/setType/setTopology: Thread-safe (atomic).
+ * - setModulatedParameters: Audio Thread only (plain members, no validation).
+ *   Once called, its target replaces setCutoff/setResonance. Coefficients are
+ *   recomputed at most every modulationInterval samples, only when the target
+ *   changed, and in StateVariable mode interpolated in between.
  * - processSample: Real-time safe. Must be called from Audio Thread.
  */
 class FilterBank
@@ -37,6 +45,15 @@ public:
         Notch
     };
 
+    enum class Topology
+    {
+        Biquad,
+        StateVariable
+    };
+
+    /** Samples between coefficient updates driven by setModulatedParameters. */
+    static constexpr int modulationInterval = 16;
+
     FilterBank() noexcept;
     ~FilterBank() = default;
 
@@ -47,6 +64,15 @@ public:
     void setCutoff(float frequencyHz) noexcept;
     void setResonance(float q) noexcept;
     void setType(FilterType newType) noexcept;
+    void setTopology(Topology newTopology) noexcept;
+
+    // --- Modulation (Audio Thread only) ---
+    /**
+     * Per-sample cutoff/resonance path for envelopes and modulation. Takes the
+     * same ranges as setCutoff/setResonance but only stores plain targets; the
+     * transcendental coefficient math runs at most once per modulationInterval.
+     */
+    void setModulatedParameters(float cutoffHz, float resonance) noexcept;
 
     // --- Processing ---
     /** Resets the internal state (buffers) of the filter. */
@@ -57,6 +83,11 @@ public:
 
 private:
     void updateCoefficients() noexcept;
+    void updateBiquadCoefficients(float f, float q) noexcept;
+    void updateStateVariableTargets(bool snap) noexcept;
+    float getTargetCutoff() const noexcept { return hasModulation_ ? modCutoffHz_ : baseCutoffHz_; }
+    float getTargetQ() const noexcept { return hasModulation_ ? modQ_ : baseQ_; }
+    float processStateVariable(float input) noexcept;
 
     // --- State ---
     double sampleRate_ = 48000.0;
@@ -69,10 +100,31 @@ private:
     float a1_ = 0.0f, a2_ = 0.0f;
     float b0_ = 1.0f, b1_ = 0.0f, b2_ = 0.0f;
 
+    // SVF state (trapezoidal integrators) and interpolated coefficients
+    float ic1eq_ = 0.0f;
+    float ic2eq_ = 0.0f;
+    float g_ = 0.0f, k_ = 1.0f;
+    float gStep_ = 0.0f, kStep_ = 0.0f;
+    float gTarget_ = 0.0f, kTarget_ = 1.0f;
+
+    // Audio-thread copies of the parameters (latched from the atomics when dirty)
+    Topology activeTopology_ = Topology::Biquad;
+    FilterType activeType_ = FilterType::LowPass;
+    float baseCutoffHz_ = 1000.0f;
+    float baseQ_ = 0.707f;
+
+    // Modulated target, kept apart so refreshing the base parameters never drops it
+    float modCutoffHz_ = 1000.0f;
+    float modQ_ = 0.707f;
+    bool hasModulation_ = false;
+    bool modulationPending_ = false;
+    int samplesUntilUpdate_ = 0;
+
     // --- Parameters (Atomics) ---
     std::atomic<float> cutoffHz_{ 1000.0f };
     std::atomic<float> resonance_{ 0.707f };
     std::atomic<FilterType> type_{ FilterType::LowPass };
+    std::atomic<Topology> topology_{ Topology::Biquad };
 
     // Dirty flag to avoid recalc coefficients every sample unless params changed
     std::atomic<bool> coefficientsDirty_{ true };
@@ -146,13 +146,52 @@ float LFO::processSample() noexcept
     }
 
     // Update phase for next sample
+    advancePhase();
+
+    return out * depth_.load(std::memory_order_relaxed);
+}
+
+void LFO::renderBlock(float* output, int numSamples) noexcept
+{
+    const Waveform waveform = currentWaveform_.load(std::memory_order_relaxed);
+
+    // S&H keeps its own per-sample state machine
+    if (waveform == Waveform::RandomSampleAndHold)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = processSample();
+        return;
+    }
+
+    // One waveform dispatch per block instead of per sample
+    const float depth = depth_.load(std::memory_order_relaxed);
+    auto render = [this, output, numSamples, depth](auto generate)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = generate() * depth;
+            advancePhase();
+        }
+    };
+
+    switch (waveform)
+    {
+        case Waveform::Sine:     render([this] { return generateSine(); }); break;
+        case Waveform::Triangle: render([this] { return generateTriangle(); }); break;
+        case Waveform::SawUp:    render([this] { return generateSawUp(); }); break;
+        case Waveform::SawDown:  render([this] { return generateSawDown(); }); break;
+        case Waveform::Square:   render([this] { return generateSquare(); }); break;
+        case Waveform::RandomSampleAndHold: break;
+    }
+}
+
+void LFO::advancePhase() noexcept
+{
     phase_ += phaseIncrement_;
     if (phase_ >= 1.0f)
         phase_ -= 1.0f;
     else if (phase_ < 0.0f)
         phase_ += 1.0f;
-
-    return out * depth_.load(std::memory_order_relaxed);
 }
 
 void LFO::updatePhaseIncrement() noexcept
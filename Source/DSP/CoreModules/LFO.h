@@ -54,6 +54,8 @@ public:
     // --- Processing (Realtime Safe) ---
     float processSample() noexcept;
     float processBlock(int numSamples) noexcept;
+    /** Writes numSamples consecutive LFO values (depth applied) into output. */
+    void renderBlock(float* output, int numSamples) noexcept;
 
 private:
     std::atomic<Waveform> currentWaveform_{ Waveform::Sine };
@@ -73,6 +75,7 @@ private:
     const float randomInterpolationSpeed_ = 0.1f; // How fast S&H interpolates
 
     void updatePhaseIncrement() noexcept;
+    void advancePhase() noexcept;
     float getSyncedRateHz() const noexcept;
 
     // Waveform generation functions
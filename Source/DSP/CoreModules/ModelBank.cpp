@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+
+    ModelBank.cpp
+    Created: 16 Oct 2026
+    Description: Implementation of the shared model bank and its RCU channel.
+
+  ==============================================================================
+*/
+
+#include "ModelBank.h"
+#include <algorithm>
+#include <numeric>
+
+namespace NEURONiK::DSP::Core {
+
+ModelBank::ModelBank(const std::array<NEURONiK::Common::SpectralModel, numSlots>& newModels) noexcept
+    : models(newModels)
+{
+    for (size_t slot = 0; slot < models.size(); ++slot)
+    {
+        const auto& amps = models[slot].amplitudes;
+        activeSlots[slot] = std::accumulate(amps.begin(), amps.end(), 0.0f) > 0.001f;
+    }
+}
+
+ModelBank::Ptr ModelBank::withModel(const NEURONiK::Common::SpectralModel& model, int slot) const
+{
+    auto newModels = models;
+    if (slot >= 0 && slot < numSlots)
+        newModels[(size_t)slot] = model;
+
+    return new ModelBank(newModels);
+}
+
+//==============================================================================
+ModelBankChannel::ModelBankChannel(ModelBank::Ptr initialBank)
+    : current(std::move(initialBank))
+{
+    jassert(current != nullptr);
+    published.store(current.get(), std::memory_order_release);
+}
+
+void ModelBankChannel::publish(ModelBank::Ptr newBank)
+{
+    if (newBank == nullptr)
+        return;
+
+    const juce::ScopedLock sl(writeLock);
+
+    retired.push_back(current);
+    current = std::move(newBank);
+    published.store(current.get(), std::memory_order_seq_cst);
+
+    reclaimRetired();
+}
+
+void ModelBankChannel::publishModel(const NEURONiK::Common::SpectralModel& model, int slot)
+{
+    const juce::ScopedLock sl(writeLock);
+    publish(current->withModel(model, slot));
+}
+
+const ModelBank* ModelBankChannel::acquire() noexcept
+{
+    // Announce the bank, then confirm it is still the published one: a writer
+    // that missed the announcement has already published a newer bank
+    const ModelBank* bank = published.load(std::memory_order_acquire);
+    for (;;)
+    {
+        inUse.store(bank, std::memory_order_seq_cst);
+
+        const ModelBank* latest = published.load(std::memory_order_seq_cst);
+        if (latest == bank)
+            return bank;
+
+        bank = latest;
+    }
+}
+
+void ModelBankChannel::reclaimRetired()
+{
+    // Everything but the bank the audio thread has announced can go
+    const ModelBank* reading = inUse.load(std::memory_order_seq_cst);
+
+    retired.erase(std::remove_if(retired.begin(), retired.end(),
+                                 [reading](const ModelBank::Ptr& bank) { return bank.get() != reading; }),
+                  retired.end());
+}
+
+} // namespace NEURONiK::DSP::Core
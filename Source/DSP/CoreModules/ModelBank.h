@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    ModelBank.h
+    Created: 16 Oct 2026
+    Description: Immutable, reference-counted set of the four morph models,
+                 shared by all voices of an engine and swapped RCU-style.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <vector>
+#include "../../Common/SpectralModel.h"
+
+namespace NEURONiK::DSP::Core {
+
+/**
+ * The four spectral models (A, B, C, D) of the XY morph.
+ *
+ * A bank never changes after construction: loading a model builds a new bank
+ * (see withModel) and publishes it through a ModelBankChannel, so every voice
+ * can read the same instance without copies or locks.
+ */
+class ModelBank : public juce::ReferenceCountedObject
+{
+public:
+    using Ptr = juce::ReferenceCountedObjectPtr<ModelBank>;
+
+    static constexpr int numSlots = 4;
+
+    explicit ModelBank(const std::array<NEURONiK::Common::SpectralModel, numSlots>& newModels) noexcept;
+
+    const NEURONiK::Common::SpectralModel& getModel(int slot) const noexcept { return models[(size_t)slot]; }
+
+    /** False if the slot is (practically) silent; the morph then falls back to another corner. */
+    bool isSlotActive(int slot) const noexcept { return activeSlots[(size_t)slot]; }
+
+    /** A new bank equal to this one with one slot replaced. Allocates. */
+    Ptr withModel(const NEURONiK::Common::SpectralModel& model, int slot) const;
+
+private:
+    std::array<NEURONiK::Common::SpectralModel, numSlots> models;
+    std::array<bool, numSlots> activeSlots {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModelBank)
+};
+
+/**
+ * Read-copy-update hand-off of the current ModelBank to the audio thread.
+ *
+ * The audio thread reads the newest bank through a raw pointer and never
+ * touches a reference count. It announces the bank it uses in a hazard
+ * pointer, and replaced banks stay alive until that pointer has moved on.
+ * They are then released by the next publish() (or the destructor), always
+ * on a writer thread.
+ *
+ * Thread-Safety:
+ * - publish / publishModel: any non-audio thread (serialized internally).
+ * - acquire: Audio Thread only. Wait-free in practice, no allocation. The
+ *   returned bank stays valid until the next acquire().
+ */
+class ModelBankChannel
+{
+public:
+    explicit ModelBankChannel(ModelBank::Ptr initialBank);
+    ~ModelBankChannel() = default;
+
+    void publish(ModelBank::Ptr newBank);
+
+    /** Replaces one slot of the newest bank and publishes the result. */
+    void publishModel(const NEURONiK::Common::SpectralModel& model, int slot);
+
+    const ModelBank* acquire() noexcept;
+
+private:
+    void reclaimRetired();
+
+    juce::CriticalSection writeLock;
+    ModelBank::Ptr current;
+    std::vector<ModelBank::Ptr> retired; // replaced banks the audio thread may still read
+
+    std::atomic<const ModelBank*> published { nullptr };
+    std::atomic<const ModelBank*> inUse { nullptr };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModelBankChannel)
+};
+
+} // namespace NEURONiK::DSP::Core
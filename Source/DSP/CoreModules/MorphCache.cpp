@@ -0,0 +1,197 @@
+/*
+  ==============================================================================
+
+    MorphCache.cpp
+    Created: 16 Oct 2026
+    Description: Implementation of the shared morph spectrum cache.
+
+  ==============================================================================
+*/
+
+#include "MorphCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NEURONiK::DSP::Core {
+
+namespace {
+
+template<typename T>
+T lerp(T a, T b, T t) { return a + t * (b - a); }
+
+const std::array<float, 64>& getLnTable()
+{
+    static const std::array<float, 64> table = []
+    {
+        std::array<float, 64> ln {};
+        for (int i = 0; i < 64; ++i)
+            ln[(size_t)i] = std::log(static_cast<float>(i + 1));
+        return ln;
+    }();
+
+    return table;
+}
+
+// exp(ln(n)), i.e. the harmonic ratios at zero stretching, bit-identical to the general path
+const std::array<float, 64>& getUnstretchedRatios()
+{
+    static const std::array<float, 64> table = []
+    {
+        std::array<float, 64> ratios {};
+        for (int i = 0; i < 64; ++i)
+            ratios[(size_t)i] = std::exp(getLnTable()[(size_t)i]);
+        return ratios;
+    }();
+
+    return table;
+}
+
+} // namespace
+
+void MorphSpectrum::compute(const ModelBank& bank, const MorphInputs& inputs, MorphSpectrum& result) noexcept
+{
+    const auto& lnTable = getLnTable();
+    const auto& unstretchedRatios = getUnstretchedRatios();
+
+    const NEURONiK::Common::SpectralModel* mA = &bank.getModel(0);
+    const NEURONiK::Common::SpectralModel* mB = &bank.getModel(1);
+    const NEURONiK::Common::SpectralModel* mC = &bank.getModel(2);
+    const NEURONiK::Common::SpectralModel* mD = &bank.getModel(3);
+
+    if (inputs.substituteSilentSlots)
+    {
+        const bool bActive = bank.isSlotActive(1);
+        const bool cActive = bank.isSlotActive(2);
+        const bool dActive = bank.isSlotActive(3);
+
+        if (!bActive) mB = mA;
+        if (!cActive) mC = mA;
+        if (!dActive) mD = (bActive ? mB : mA);
+
+        if (bActive && !cActive && !dActive) {
+            mC = mA;
+            mD = mB;
+        }
+    }
+
+    const float evenScale = juce::jlimit(0.0f, 1.0f, inputs.parity * 2.0f);
+    const float oddScale = juce::jlimit(0.0f, 1.0f, (1.0f - inputs.parity) * 2.0f);
+    const float stretchExponent = 1.0f + inputs.stretching * 0.5f;
+    const bool neutralRollOff = inputs.rollOff == 1.0f;
+    const bool unstretched = inputs.stretching == 0.0f;
+
+    float totalAmplitude = 0.0f;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        float ampTop = lerp(mA->amplitudes[i], mB->amplitudes[i], inputs.morphX);
+        float ampBottom = lerp(mC->amplitudes[i], mD->amplitudes[i], inputs.morphX);
+        float baseAmp = lerp(ampTop, ampBottom, inputs.morphY);
+
+        bool isEven = ((i + 1) % 2 == 0);
+        float parityScale = isEven ? evenScale : oddScale;
+
+        // Fast power approximation using exp(ln(n)*x); exp(0) needs no call
+        float rollOffScale = neutralRollOff ? 1.0f : std::exp(-lnTable[(size_t)i] * (inputs.rollOff - 1.0f));
+
+        result.amplitudes[(size_t)i] = baseAmp * parityScale * rollOffScale;
+        totalAmplitude += result.amplitudes[(size_t)i];
+
+        float offsetTop = lerp(mA->frequencyOffsets[i], mB->frequencyOffsets[i], inputs.morphX);
+        float offsetBottom = lerp(mC->frequencyOffsets[i], mD->frequencyOffsets[i], inputs.morphX);
+        result.frequencyOffsets[(size_t)i] = lerp(offsetTop, offsetBottom, inputs.morphY);
+
+        result.harmonicRatios[(size_t)i] = unstretched ? unstretchedRatios[(size_t)i]
+                                                       : std::exp(lnTable[(size_t)i] * stretchExponent);
+    }
+
+    result.totalAmplitude = totalAmplitude;
+
+    // In an analysed sound the weak partials are mostly the ones that died out
+    // early, so modal resonators ring them shorter: decay time 0.25..1 of the
+    // strongest partial's, following the square root of the relative amplitude
+    const float peak = *std::max_element(result.amplitudes.begin(), result.amplitudes.end());
+    const float invPeak = peak > 0.0f ? 1.0f / peak : 0.0f;
+    for (size_t i = 0; i < result.dampingScales.size(); ++i)
+    {
+        const float relative = juce::jlimit(0.0f, 1.0f, result.amplitudes[i] * invPeak);
+        result.dampingScales[i] = peak > 0.0f ? 1.0f / (0.25f + 0.75f * std::sqrt(relative)) : 1.0f;
+    }
+}
+
+//==============================================================================
+void MorphCache::invalidate() noexcept
+{
+    if (++generation != 0)
+        return;
+
+    // Wrapped around: stale entries could look current again
+    for (auto& entry : entries)
+        entry.generation = 0;
+    generation = 1;
+}
+
+const MorphSpectrum& MorphCache::getSpectrum(const ModelBank& bank, const MorphInputs& inputs) noexcept
+{
+    const Key key = makeKey(bank, inputs);
+    const int home = (int)(hashKey(key) & (uint32_t)(numEntries - 1));
+
+    // Linear probing; nothing is removed within a generation, so the first
+    // stale slot ends the search
+    Entry* target = &entries[(size_t)home];
+    for (int probe = 0; probe < numEntries; ++probe)
+    {
+        Entry& entry = entries[(size_t)((home + probe) & (numEntries - 1))];
+
+        if (entry.generation != generation)
+        {
+            target = &entry;
+            break;
+        }
+
+        if (entry.key == key)
+            return entry.spectrum;
+    }
+
+    // Compute from the quantized values, so a hit never depends on which voice came first
+    MorphInputs quantized = inputs;
+    quantized.morphX = (float)key.values[0] / quantizationSteps;
+    quantized.morphY = (float)key.values[1] / quantizationSteps;
+    quantized.parity = (float)key.values[2] / quantizationSteps;
+    quantized.rollOff = (float)key.values[3] / quantizationSteps;
+    quantized.stretching = (float)key.values[4] / quantizationSteps;
+
+    target->key = key;
+    target->generation = generation;
+    MorphSpectrum::compute(bank, quantized, target->spectrum);
+    return target->spectrum;
+}
+
+MorphCache::Key MorphCache::makeKey(const ModelBank& bank, const MorphInputs& inputs) noexcept
+{
+    Key key;
+    key.bank = &bank;
+    key.values = { juce::roundToInt(inputs.morphX * quantizationSteps),
+                   juce::roundToInt(inputs.morphY * quantizationSteps),
+                   juce::roundToInt(inputs.parity * quantizationSteps),
+                   juce::roundToInt(inputs.rollOff * quantizationSteps),
+                   juce::roundToInt(inputs.stretching * quantizationSteps) };
+    key.substituteSilentSlots = inputs.substituteSilentSlots;
+    return key;
+}
+
+uint32_t MorphCache::hashKey(const Key& key) noexcept
+{
+    // FNV-1a over the quantized values, then a final avalanche
+    uint32_t hash = 2166136261u;
+    for (const auto value : key.values)
+        hash = (hash ^ (uint32_t)value) * 16777619u;
+
+    hash ^= (uint32_t)key.substituteSilentSlots;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+} // namespace NEURONiK::DSP::Core
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    MorphCache.h
+    Created: 16 Oct 2026
+    Description: Per-engine cache of morphed amplitude spectra, shared by all
+                 voices within one control tick.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cstdint>
+#include "ModelBank.h"
+
+namespace NEURONiK::DSP::Core {
+
+/** The pitch-independent inputs of the 4-model morph. */
+struct MorphInputs
+{
+    float morphX = 0.0f;
+    float morphY = 0.0f;
+    float parity = 0.5f;      // 0.5 leaves odd and even partials untouched
+    float rollOff = 1.0f;     // 1.0 leaves the model slope untouched
+    float stretching = 0.0f;  // inharmonicity of the harmonic ratios
+    bool substituteSilentSlots = false; // morph towards A/B instead of a silent corner
+};
+
+/**
+ * Result of the bilinear morph for one set of MorphInputs. Everything that
+ * depends on the note (base frequency, shift, Nyquist limit, unison) is left
+ * to the voice.
+ */
+struct MorphSpectrum
+{
+    std::array<float, 64> amplitudes;       // morphed and shaped, not normalized
+    std::array<float, 64> frequencyOffsets; // Hz, added after the harmonic mapping
+    std::array<float, 64> harmonicRatios;   // (stretched) harmonic number of each partial
+    std::array<float, 64> dampingScales;    // modal resonators: 1 for the strongest partial, up to 4 for silent ones
+    float totalAmplitude = 0.0f;            // sum of amplitudes, for normalization
+
+    static void compute(const ModelBank& bank, const MorphInputs& inputs, MorphSpectrum& result) noexcept;
+};
+
+/**
+ * Hands out morphed spectra keyed by a hash of the quantized MorphInputs (and
+ * the bank), so voices playing with identical morph/parity/roll-off settings
+ * share one computation instead of running 64 exp() calls each.
+ *
+ * Entries live for one control tick: invalidate() forgets them all in O(1).
+ * With at most one lookup per voice and tick, the table never fills up; if it
+ * does, the oldest probe slot is simply overwritten.
+ *
+ * Thread-Safety:
+ * - Audio Thread only, from the serial part of the render (never from render jobs).
+ */
+class MorphCache
+{
+public:
+    static constexpr int numEntries = 64;
+
+    MorphCache() = default;
+
+    /** Forgets every entry. Called at each control tick and when the model bank changes. */
+    void invalidate() noexcept;
+
+    /** The spectrum for the quantized inputs; valid until the next call. */
+    const MorphSpectrum& getSpectrum(const ModelBank& bank, const MorphInputs& inputs) noexcept;
+
+private:
+    // Fine enough that a quantized morph step is inaudible
+    static constexpr float quantizationSteps = 8192.0f;
+
+    struct Key
+    {
+        const ModelBank* bank = nullptr;
+        std::array<int32_t, 5> values {};
+        bool substituteSilentSlots = false;
+
+        bool operator== (const Key& other) const noexcept
+        {
+            return bank == other.bank && values == other.values
+                && substituteSilentSlots == other.substituteSilentSlots;
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        uint32_t generation = 0;
+        MorphSpectrum spectrum;
+    };
+
+    static Key makeKey(const ModelBank& bank, const MorphInputs& inputs) noexcept;
+    static uint32_t hashKey(const Key& key) noexcept;
+
+    std::array<Entry, numEntries> entries;
+    uint32_t generation = 1; // entries with an older generation count as empty
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MorphCache)
+};
+
+} // namespace NEURONiK::DSP::Core
@@ -17,33 +17,30 @@
 
 namespace NEURONiK::DSP {
 
-class NeuronikEngine : public BaseEngine
+class NeuronikEngine : public BaseEngine<Synthesis::AdditiveVoice>
 {
 public:
     NeuronikEngine();
     ~NeuronikEngine() override = default;
 
     // --- ISynthesisEngine Implementation ---
-    void prepare(double sampleRate, int samplesPerBlock) override;
     void renderNextBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
-    void updateParameters() override;
-    void getSpectralData(float* destination64) const override;
-    void getEnvelopeLevels(float& amp, float& filter) const override;
-    void getModulationValues(float* destination, int count) const override;
 
-    // --- Specific API ---
-    void setVoiceParams(const ::NEURONiK::DSP::Synthesis::AdditiveVoice::Params& p);
-    
-    void setGlobalParams(const GlobalParams& p) override { pendingGlobalParams = p; }
+private:
+    // A render job: either a full resonator batch or a single voice
+    struct RenderGroup
+    {
+        int voices[Core::Resonator::batchWidth];
+        int numVoices;
+    };
 
-    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) override;
+    void renderVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+    void renderGroup(const RenderGroup& group, int numSamples) noexcept;
 
-private:
-    void handleMidiEvent(const juce::MidiMessage& m) override;
-    void applyModulation();
+    std::array<RenderGroup, maxVoices> renderList;
 
-    ::NEURONiK::DSP::Synthesis::AdditiveVoice::Params pendingVoiceParams;
-    std::array<float, 64> lastModulations { 0.0f };
+    // Voices rendered in the current segment, in voice order (mixdown order)
+    std::array<int, maxVoices> mixList;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NeuronikEngine)
 };
@@ -14,35 +14,35 @@
 #include "../Synthesis/NeurotikVoice.h"
 #include "../../Common/SpectralModel.h"
 #include <array>
+#include <atomic>
 
 namespace NEURONiK::DSP {
 
-class NeurotikEngine : public BaseEngine
+class NeurotikEngine : public BaseEngine<Synthesis::NeurotikVoice>
 {
 public:
     NeurotikEngine();
     ~NeurotikEngine() override = default;
 
     // --- ISynthesisEngine Implementation ---
-    void prepare(double sampleRate, int samplesPerBlock) override;
     void renderNextBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
-    void updateParameters() override;
-    void getSpectralData(float* destination64) const override;
-    void getEnvelopeLevels(float& amp, float& filter) const override;
-    void getModulationValues(float* destination, int count) const override;
 
-    // --- Specific API ---
-    void setVoiceParams(const ::NEURONiK::DSP::Synthesis::NeurotikVoice::Params& p);
-    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) override;
-
-    void setGlobalParams(const GlobalParams& p) override { pendingGlobalParams = p; }
+    /**
+     * Resonator topology of every voice (biquad or modal bank), so CPU and
+     * timbre can be compared per engine instance. Thread-safe; takes effect at
+     * the next block, restarting the resonators from silence.
+     */
+    void setResonatorMode(Core::ResonatorBank::Mode mode) noexcept { requestedResonatorMode.store(mode); }
+    Core::ResonatorBank::Mode getResonatorMode() const noexcept { return requestedResonatorMode.load(); }
 
 private:
-    void handleMidiEvent(const juce::MidiMessage& m) override;
-    void applyModulation();
+    void renderVoices(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+    std::atomic<Core::ResonatorBank::Mode> requestedResonatorMode { Core::ResonatorBank::Mode::Biquad };
+    Core::ResonatorBank::Mode activeResonatorMode = Core::ResonatorBank::Mode::Biquad;
 
-    ::NEURONiK::DSP::Synthesis::NeurotikVoice::Params pendingVoiceParams;
-    std::array<float, 64> lastModulations { 0.0f };
+    // Voices rendered in the current segment, in voice order (mixdown order)
+    std::array<int, maxVoices> mixList;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NeurotikEngine)
 };
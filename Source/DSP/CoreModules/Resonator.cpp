@@ -12,57 +12,69 @@
 #include "../DSPUtils.h"
 #include <cmath>
 #include <numeric>
+#include <algorithm>
 
 namespace NEURONiK::DSP::Core {
 
-// Helper function for linear interpolation
-template<typename T>
-T lerp(T a, T b, T t) { return a + t * (b - a); }
-
-// Fast Xorshift32 implementation for entropy
-inline float fastFloatRand(uint32_t& state)
+// Decorrelated, non-zero xorshift32 seed for partial lane k (murmur3 finalizer)
+inline uint32_t laneSeed(uint32_t seed, int k)
 {
-    state ^= state << 13;
-    state ^= state >> 17;
-    state ^= state << 5;
-    return ((state & 0xFFFF) / 32768.0f) - 1.0f; 
+    uint32_t h = seed + 0x9e3779b9u * (uint32_t)(k + 1);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h != 0 ? h : 0x6d2b79f5u;
 }
 
-Resonator::Resonator() noexcept
+const ModelBank::Ptr& Resonator::getDefaultModelBank()
 {
-    partialAmplitudes.fill(0.0f);
-    for (auto& model : models)
+    static const ModelBank::Ptr bank = []
     {
-        model.amplitudes.fill(0.0f);
-        model.frequencyOffsets.fill(0.0f);
-    }
+        std::array<SpectralModel, ModelBank::numSlots> models;
+        for (auto& model : models)
+        {
+            model.amplitudes.fill(0.0f);
+            model.frequencyOffsets.fill(0.0f);
+        }
 
-    // --- Define 4 distinct spectral models for testing the XY Pad ---
+        // --- Define 4 distinct spectral models for testing the XY Pad ---
 
-    // Model A (Top-Left): Sawtooth-like (1/n falloff)
-    for (int i = 0; i < 64; ++i) models[0].amplitudes[i] = 1.0f / (i + 1.0f);
+        // Model A (Top-Left): Sawtooth-like (1/n falloff)
+        for (int i = 0; i < 64; ++i) models[0].amplitudes[i] = 1.0f / (i + 1.0f);
 
-    // Model B (Top-Right): Square-like (1/n falloff, odd harmonics)
-    for (int i = 0; i < 64; i += 2) models[1].amplitudes[i] = 1.0f / (i + 1.0f);
+        // Model B (Top-Right): Square-like (1/n falloff, odd harmonics)
+        for (int i = 0; i < 64; i += 2) models[1].amplitudes[i] = 1.0f / (i + 1.0f);
 
-    // Model C (Bottom-Left): Triangle-like (1/n^2 falloff, odd harmonics)
-    for (int i = 0; i < 64; i += 2) models[2].amplitudes[i] = 1.0f / ((i + 1.0f) * (i + 1.0f));
+        // Model C (Bottom-Left): Triangle-like (1/n^2 falloff, odd harmonics)
+        for (int i = 0; i < 64; i += 2) models[2].amplitudes[i] = 1.0f / ((i + 1.0f) * (i + 1.0f));
 
-    // Model D (Bottom-Right): Sine wave (fundamental only)
-    models[3].amplitudes[0] = 1.0f;
+        // Model D (Bottom-Right): Sine wave (fundamental only)
+        models[3].amplitudes[0] = 1.0f;
 
-    // --- Normalize all models to have a total amplitude of 1.0 ---
-    for (auto& model : models) {
-        float sum = std::accumulate(model.amplitudes.begin(), model.amplitudes.end(), 0.0f);
-        if (sum > 0.0f) {
-            for (float& amp : model.amplitudes) {
-                amp /= sum;
+        // --- Normalize all models to have a total amplitude of 1.0 ---
+        for (auto& model : models) {
+            float sum = std::accumulate(model.amplitudes.begin(), model.amplitudes.end(), 0.0f);
+            if (sum > 0.0f) {
+                for (float& amp : model.amplitudes) {
+                    amp /= sum;
+                }
             }
         }
-    }
+
+        return ModelBank::Ptr(new ModelBank(models));
+    }();
+
+    return bank;
+}
+
+Resonator::Resonator() noexcept
+{
+    modelBank = getDefaultModelBank().get();
 
     // Set initial state from model A
-    partialAmplitudes = models[0].amplitudes;
+    partialAmplitudes = modelBank->getModel(0).amplitudes;
 
     for (int i = 0; i < 64; ++i)
     {
@@ -71,14 +83,15 @@ Resonator::Resonator() noexcept
 
     // Seed the fast random generator
     randomSeed = (uint32_t)juce::Time::getMillisecondCounter();
-
-    for (int i = 0; i < 64; ++i)
-        lnTable[i] = std::log(static_cast<float>(i + 1));
+    for (int k = 0; k < 128; ++k)
+        noiseStates[k] = laneSeed(randomSeed, k);
 }
 
 void Resonator::setSampleRate(double sr) noexcept
 {
     sampleRate = sr;
+    kernels = &Kernels::selectResonatorKernels();
+    modelChanged = true; // increments and padding granularity depend on both
     for (auto& p : partials)
     {
         p.setSampleRate(sr);
@@ -90,11 +103,29 @@ void Resonator::setBaseFrequency(float hz) noexcept
     baseFrequency = validateAudioParam(hz, 10.0f, 20000.0f, 440.0f, "Resonator baseFrequency");
 }
 
-void Resonator::loadModel(const SpectralModel& model, int slot) noexcept
+void Resonator::loadModel(const SpectralModel& model, int slot)
+{
+    if (slot >= 0 && slot < ModelBank::numSlots)
+    {
+        ownModelBank = modelBank->withModel(model, slot);
+        setModelBank(ownModelBank.get());
+    }
+}
+
+void Resonator::setModelBank(const ModelBank* bank) noexcept
+{
+    if (bank != nullptr && bank != modelBank)
+    {
+        modelBank = bank;
+        modelChanged = true;
+    }
+}
+
+void Resonator::setMorphCache(MorphCache* cache) noexcept
 {
-    if (slot >= 0 && slot < 4)
+    if (cache != morphCache)
     {
-        models[slot] = model;
+        morphCache = cache;
         modelChanged = true;
     }
 }
@@ -151,163 +182,179 @@ void Resonator::updateHarmonicsFromModels(float morphX, float morphY) noexcept
     lastRollOff = rollOffAmount; lastUnisonDetune = unisonDetune;
     modelChanged = false;
 
-    float totalAmplitude = 0.0f;
-
-    const SpectralModel* mA = &models[0];
-    const SpectralModel* mB = &models[1];
-    const SpectralModel* mC = &models[2];
-    const SpectralModel* mD = &models[3];
-
-    bool bActive = std::accumulate(models[1].amplitudes.begin(), models[1].amplitudes.end(), 0.0f) > 0.001f;
-    bool cActive = std::accumulate(models[2].amplitudes.begin(), models[2].amplitudes.end(), 0.0f) > 0.001f;
-    bool dActive = std::accumulate(models[3].amplitudes.begin(), models[3].amplitudes.end(), 0.0f) > 0.001f;
-
-    if (!bActive) mB = mA;
-    if (!cActive) mC = mA;
-    if (!dActive) mD = (bActive ? mB : mA);
+    MorphInputs inputs;
+    inputs.morphX = morphX;
+    inputs.morphY = morphY;
+    inputs.parity = parityAmount;
+    inputs.rollOff = rollOffAmount;
+    inputs.stretching = stretchingAmount;
+    inputs.substituteSilentSlots = true;
+
+    // The morph itself is shared between voices through the engine's cache;
+    // only the pitch-dependent mapping below is per voice
+    MorphSpectrum localSpectrum;
+    const MorphSpectrum* spectrum = &localSpectrum;
+    if (morphCache != nullptr)
+        spectrum = &morphCache->getSpectrum(*modelBank, inputs);
+    else
+        MorphSpectrum::compute(*modelBank, inputs, localSpectrum);
+
+    const float nyquistLimit = static_cast<float>(sampleRate * 0.45);
+    float invNorm = (spectrum->totalAmplitude > 0.0001f) ? (1.0f / spectrum->totalAmplitude) : 0.0f;
+    
+    // Unison calculation
+    float detuneRatio = 1.0f + unisonDetune;
     
-    if (bActive && !cActive && !dActive) {
-        mC = mA;
-        mD = mB;
-    }
-
-    float tempAmps[64];
-
     for (int i = 0; i < 64; ++i)
     {
+        const float amp = spectrum->amplitudes[(size_t)i];
+        float partialFreq = (baseFrequency * spectrum->harmonicRatios[(size_t)i] * shiftAmount) + spectrum->frequencyOffsets[(size_t)i];
 
-        float ampTop = lerp(mA->amplitudes[i], mB->amplitudes[i], morphX);
-        float ampBottom = lerp(mC->amplitudes[i], mD->amplitudes[i], morphX);
-        float baseAmp = lerp(ampTop, ampBottom, morphY);
-        
-        bool isEven = ((i + 1) % 2 == 0);
-        float parityScale = isEven ? juce::jlimit(0.0f, 1.0f, parityAmount * 2.0f) 
-                                   : juce::jlimit(0.0f, 1.0f, (1.0f - parityAmount) * 2.0f);
-        
-        // Fast power approximation using exp(ln(n)*x)
-        float rollOffScale = std::exp(-lnTable[i] * (rollOffAmount - 1.0f));
-
-        tempAmps[i] = baseAmp * parityScale * rollOffScale;
-        totalAmplitude += tempAmps[i];
-
-        float offsetTop = lerp(mA->frequencyOffsets[i], mB->frequencyOffsets[i], morphX);
-        float offsetBottom = lerp(mC->frequencyOffsets[i], mD->frequencyOffsets[i], morphX);
-        float morphedOffset = lerp(offsetTop, offsetBottom, morphY);
-
-        float stretchedHarmonic = std::exp(lnTable[i] * (1.0f + stretchingAmount * 0.5f));
-        float partialFreq = (baseFrequency * stretchedHarmonic * shiftAmount) + morphedOffset;
-
-        if (partialFreq < static_cast<float>(sampleRate * 0.45) && tempAmps[i] > 0.0001f)
+        if (partialFreq < nyquistLimit && amp > 0.0001f)
             phaseIncrements[i] = partialFreq / static_cast<float>(sampleRate);
         else
             phaseIncrements[i] = 0.0f;
-    }
 
-    float invNorm = (totalAmplitude > 0.0001f) ? (1.0f / totalAmplitude) : 0.0f;
-    
-    // Unison calculation
-    float detuneRatio = 1.0f + unisonDetune;
-    
-    for (int i = 0; i < 64; ++i)
-    {
-        partialAmplitudes[i] = tempAmps[i] * invNorm;
+        partialAmplitudes[i] = amp * invNorm;
         
         // Slot 0-63: Main Partials
         amplitudes_v[i] = partialAmplitudes[i];
         
         // Slot 64-127: Unison Partials
-        // If unisonDetune is approx 0, we can skip or keep them at 0 amp? 
-        // Better to always calculate for branchless processing in processSample
+        // Always calculated (zero when off) for branchless processing in processSample
         float unisonAmp = (unisonDetune > 0.0001f) ? (amplitudes_v[i] * 0.707f) : 0.0f; // Lower gain for unison layer
         amplitudes_v[i + 64] = unisonAmp;
         
-        // Main frequency was already in phaseIncrements[i]
         // Unison frequency
         phaseIncrements[i + 64] = phaseIncrements[i] * detuneRatio;
         
         // Panning/Spread would require stereo output from processSample, 
         // for now we just sum them mono.
     }
+
+    rebuildActivePartials();
 }
 
-void Resonator::prepareEntropy(int numSamples) noexcept
+void Resonator::rebuildActivePartials() noexcept
 {
-    if (entropyAmount < 0.001f) return;
-    
-    if (ampJitterBuffer.size() < (size_t)numSamples) ampJitterBuffer.resize(numSamples);
-    if (phaseJitterBuffer.size() < (size_t)numSamples) phaseJitterBuffer.resize(numSamples);
-    
-    for (int s = 0; s < numSamples; ++s)
+    // Park the running phases back in their slots before re-selecting
+    for (int k = 0; k < numActivePartials; ++k)
+        currentPhases[activeSlots[k]] = activePhases[k];
+
+    int count = 0;
+    for (int i = 0; i < 128; ++i)
+    {
+        if (phaseIncrements[i] != 0.0f && amplitudes_v[i] > 0.0f)
+        {
+            activeSlots[count] = static_cast<uint8_t>(i);
+            activePhases[count] = currentPhases[i];
+            activeIncrements[count] = phaseIncrements[i];
+            activeAmplitudes[count] = amplitudes_v[i];
+            ++count;
+        }
+    }
+    numActivePartials = count;
+
+    // Pad with silent lanes (zero increment and amplitude) up to a whole kernel step
+    const int granularity = kernels->partialGranularity;
+    numRenderPartials = ((count + granularity - 1) / granularity) * granularity;
+    for (int k = count; k < numRenderPartials; ++k)
     {
-        ampJitterBuffer[s] = 1.0f + fastFloatRand(randomSeed) * entropyAmount * 0.5f;
-        phaseJitterBuffer[s] = fastFloatRand(randomSeed) * entropyAmount * 0.2f;
+        activePhases[k] = 0.0f;
+        activeIncrements[k] = 0.0f;
+        activeAmplitudes[k] = 0.0f;
     }
 }
 
 float Resonator::processSample() noexcept
 {
-    // Note: To truly eliminate branching, we'd need a processBlock in Resonator
-    // that takes a sample index. For now, this is a placeholder for future block-op.
-    return processSample(0); // This won't work as is, keeping original for now but cleaner
+    // Single-sample entry point (ModelMaker preview). The voices use processBlock.
+    if (isEntropyActive())
+    {
+        float out = 0.0f;
+        kernels->renderBlockEntropy(activePhases, activeIncrements, activeAmplitudes, noiseStates,
+                                    entropyAmount, numRenderPartials, &out, 1);
+        return out;
+    }
+
+    return kernels->renderSample(activePhases, activeIncrements, activeAmplitudes, numRenderPartials);
+}
+
+void Resonator::processBlock(float* out, int numSamples) noexcept
+{
+    if (isEntropyActive())
+    {
+        kernels->renderBlockEntropy(activePhases, activeIncrements, activeAmplitudes, noiseStates,
+                                    entropyAmount, numRenderPartials, out, numSamples);
+        return;
+    }
+
+    kernels->renderBlock(activePhases, activeIncrements, activeAmplitudes, numRenderPartials, out, numSamples);
 }
 
-float Resonator::processSample(int sampleIdx) noexcept
+void Resonator::processBatch(Resonator* const* resonators, float* const* outputs, int numSamples) noexcept
 {
-    // Entropy path (rarely used, kept separate to keep SIMD hot)
-    if (entropyAmount > 0.001f)
+    // Gather: row p holds active partial p of every batched voice (the voices need
+    // not share partials; shorter lists are padded with silent lanes). The batch
+    // runs the phase in bipolar form (x = 2 * phase - 1) and folds the parabola's
+    // factor 4 into the amplitude, which saves three multiplies/subtracts per partial.
+    alignas(16) float phasesSoA[128 * batchWidth];
+    alignas(16) float incrementsSoA[128 * batchWidth];
+    alignas(16) float amplitudesSoA[128 * batchWidth];
+
+    int numRows = 0;
+    for (int v = 0; v < batchWidth; ++v)
+        numRows = std::max(numRows, resonators[v]->numActivePartials);
+
+    for (int p = 0; p < numRows; ++p)
     {
-        float out = 0.0f;
-        float ampJitter = ampJitterBuffer[sampleIdx];
-        float phaseJitter = phaseJitterBuffer[sampleIdx];
-        
-        for (int i = 0; i < 128; ++i)
+        for (int v = 0; v < batchWidth; ++v)
         {
-            if (amplitudes_v[i] > 0.0001f)
-            {
-                currentPhases[i] += phaseIncrements[i] + phaseJitter;
-                if (currentPhases[i] >= 1.0f) currentPhases[i] -= 1.0f;
-                else if (currentPhases[i] < 0.0f) currentPhases[i] += 1.0f;
-                
-                float x = currentPhases[i] * 2.0f - 1.0f;
-                float s = 4.0f * x * (1.0f - std::abs(x));
-                out += s * (amplitudes_v[i] * ampJitter);
-            }
+            const Resonator& r = *resonators[v];
+            const bool used = p < r.numActivePartials;
+            phasesSoA[p * batchWidth + v] = used ? r.activePhases[p] * 2.0f - 1.0f : 0.0f;
+            incrementsSoA[p * batchWidth + v] = used ? r.activeIncrements[p] * 2.0f : 0.0f;
+            amplitudesSoA[p * batchWidth + v] = used ? r.activeAmplitudes[p] * 4.0f : 0.0f;
         }
-        return out;
     }
 
-    // SIMD Optimized Path (Standard)
-    __m128 totalSumV = _mm_setzero_ps();
     const __m128 oneV = _mm_set1_ps(1.0f);
     const __m128 twoV = _mm_set1_ps(2.0f);
-    const __m128 fourV = _mm_set1_ps(4.0f);
     const __m128 absMaskV = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
 
-    for (int i = 0; i < 128; i += 4)
+    alignas(16) float frame[batchWidth];
+
+    for (int s = 0; s < numSamples; ++s)
     {
-        __m128 phaseV = _mm_loadu_ps(&currentPhases[i]);
-        __m128 incV = _mm_loadu_ps(&phaseIncrements[i]);
-        __m128 ampV = _mm_loadu_ps(&amplitudes_v[i]);
+        __m128 totalSumV = _mm_setzero_ps();
 
-        // Phase accumulation
-        phaseV = _mm_add_ps(phaseV, incV);
-        
-        // Wrap phase [0, 1] using mask and subtraction
-        __m128 wrapMask = _mm_cmpge_ps(phaseV, oneV);
-        phaseV = _mm_sub_ps(phaseV, _mm_and_ps(wrapMask, oneV));
-        _mm_storeu_ps(&currentPhases[i], phaseV);
+        for (int p = 0; p < numRows; ++p)
+        {
+            float* phasePtr = &phasesSoA[p * batchWidth];
+            __m128 xV = _mm_add_ps(_mm_load_ps(phasePtr), _mm_load_ps(&incrementsSoA[p * batchWidth]));
+
+            // Wrap [-1, 1)
+            __m128 wrapMask = _mm_cmpge_ps(xV, oneV);
+            xV = _mm_sub_ps(xV, _mm_and_ps(wrapMask, twoV));
+            _mm_store_ps(phasePtr, xV);
 
-        // Parabolic Sine: 4 * x * (1 - abs(x))
-        __m128 xV = _mm_sub_ps(_mm_mul_ps(phaseV, twoV), oneV);
-        __m128 absXV = _mm_and_ps(xV, absMaskV);
-        __m128 sV = _mm_mul_ps(fourV, _mm_mul_ps(xV, _mm_sub_ps(oneV, absXV)));
+            // Parabolic Sine: (4 * amp) * x * (1 - abs(x))
+            __m128 absXV = _mm_and_ps(xV, absMaskV);
+            __m128 sV = _mm_mul_ps(xV, _mm_sub_ps(oneV, absXV));
+
+            // Each lane accumulates its own voice: no horizontal reduction
+            totalSumV = _mm_add_ps(totalSumV, _mm_mul_ps(sV, _mm_load_ps(&amplitudesSoA[p * batchWidth])));
+        }
 
-        totalSumV = _mm_add_ps(totalSumV, _mm_mul_ps(sV, ampV));
+        _mm_store_ps(frame, totalSumV);
+        for (int v = 0; v < batchWidth; ++v)
+            outputs[v][s] = frame[v];
     }
 
-    alignas(16) float res[4];
-    _mm_storeu_ps(res, totalSumV);
-    return res[0] + res[1] + res[2] + res[3];
+    // Scatter phases back so the voices can continue on the per-voice path
+    for (int v = 0; v < batchWidth; ++v)
+        for (int p = 0; p < resonators[v]->numActivePartials; ++p)
+            resonators[v]->activePhases[p] = (phasesSoA[p * batchWidth + v] + 1.0f) * 0.5f;
 }
 
 void Resonator::reset() noexcept
@@ -315,6 +362,7 @@ void Resonator::reset() noexcept
     for (int i = 0; i < 128; ++i)
     {
         currentPhases[i] = 0.0f;
+        activePhases[i] = 0.0f;
     }
 }
 
@@ -15,6 +15,9 @@
 #include <array>
 #include <immintrin.h>
 #include "Oscillator.h"
+#include "ResonatorKernels.h"
+#include "ModelBank.h"
+#include "MorphCache.h"
 
 #include "SpectralModel.h"
 
@@ -30,7 +33,21 @@ public:
     void setSampleRate(double sr) noexcept;
     void setBaseFrequency(float hz) noexcept;
 
-    void loadModel(const SpectralModel& model, int slot) noexcept;
+    /** Standalone use (Model Maker): replaces one slot in a bank private to this resonator. Allocates. */
+    void loadModel(const SpectralModel& model, int slot);
+
+    /**
+     * Points the resonator at a shared bank (owned by the engine, never null).
+     * Nothing is copied; the harmonics are recomputed at the next update.
+     */
+    void setModelBank(const ModelBank* bank) noexcept;
+    const ModelBank& getModelBank() const noexcept { return *modelBank; }
+
+    /** The four built-in test models (saw, square, triangle, sine), shared by every resonator. */
+    static const ModelBank::Ptr& getDefaultModelBank();
+
+    /** Shares the morph with other voices (owned by the engine); nullptr computes it locally. */
+    void setMorphCache(MorphCache* cache) noexcept;
 
     // --- Real-time safe processing ---
     void updateHarmonicsFromModels(float morphX, float morphY) noexcept;
@@ -41,21 +58,48 @@ public:
     void setRollOff(float amount) noexcept;
     void setUnison(float detune, float spread) noexcept;
     float processSample() noexcept;
-    float processSample(int sampleIdx) noexcept;
+
+    /**
+     * Renders numSamples into out (overwriting it). Loops partial-major so each
+     * partial group's phase, increment and amplitude stay in registers for the
+     * whole block. With entropy active every partial gets its own amplitude and
+     * phase jitter from a per-partial generator.
+     */
+    void processBlock(float* out, int numSamples) noexcept;
     void reset() noexcept;
-    
-    // Call once per block to pre-calculate jitter if entropy is active
-    void prepareEntropy(int numSamples) noexcept;
+
+    /** Number of resonators advanced together by processBatch (one per SSE lane). */
+    static constexpr int batchWidth = 4;
+
+    /**
+     * Renders batchWidth resonators side by side in a structure-of-arrays layout
+     * (one voice per SIMD lane), so no horizontal sum is needed per sample.
+     * Entropy is not applied here; callers must only batch resonators for which
+     * isEntropyActive() is false.
+     */
+    static void processBatch(Resonator* const* resonators, float* const* outputs, int numSamples) noexcept;
+
+    bool isEntropyActive() const noexcept { return entropyAmount > 0.001f; }
+
+    /** Name of the SIMD kernel variant picked for this CPU by setSampleRate(). */
+    const char* getKernelName() const noexcept { return kernels->name; }
 
     const std::array<float, 64>& getPartialAmplitudes() const noexcept { return partialAmplitudes; }
-    const std::array<SpectralModel, 4>& getModels() const noexcept { return models; }
+
+    /** Audible partials (main + unison) currently rendered, before padding. */
+    int getNumActivePartials() const noexcept { return numActivePartials; }
 
 private:
+    // Rebuilds the compacted active list after the latch in updateHarmonicsFromModels fires
+    void rebuildActivePartials() noexcept;
+
     std::array<Oscillator, 128> partials;
     std::array<float, 64> partialAmplitudes; // 64 for visualization (main engine)
     
-    // Four models for 2D morphing (A, B, C, D)
-    std::array<SpectralModel, 4> models;
+    // Four models for 2D morphing (A, B, C, D), shared and immutable
+    const ModelBank* modelBank = nullptr;
+    ModelBank::Ptr ownModelBank; // only set by loadModel()
+    MorphCache* morphCache = nullptr;
 
     float baseFrequency = 440.0f;
     double sampleRate = 48000.0;
@@ -83,16 +127,25 @@ private:
     // Fast random seed
     uint32_t randomSeed = 1234567;
 
-    // SIMD Buffers
-    alignas(16) float currentPhases[128] = {0};
-    alignas(16) float phaseIncrements[128] = {0};
-    alignas(16) float amplitudes_v[128] = {0};
-
-    std::array<float, 64> lnTable;
-
-    // Entropy Buffers (for block processing)
-    std::vector<float> ampJitterBuffer;
-    std::vector<float> phaseJitterBuffer;
+    // Roughness: one xorshift32 state per active partial (never zero)
+    alignas(64) uint32_t noiseStates[128];
+
+    // SIMD Buffers (64-byte aligned for the widest kernel)
+    alignas(64) float currentPhases[128] = {0};
+    alignas(64) float phaseIncrements[128] = {0};
+    alignas(64) float amplitudes_v[128] = {0};
+
+    // Compacted view of the partials that are actually audible (below Nyquist and
+    // above the amplitude threshold). The render loops only walk these; the slot
+    // arrays above keep the phases of inactive partials until they return.
+    alignas(64) float activePhases[128] = {0};
+    alignas(64) float activeIncrements[128] = {0};
+    alignas(64) float activeAmplitudes[128] = {0};
+    std::array<uint8_t, 128> activeSlots {};
+    int numActivePartials = 0;
+    int numRenderPartials = 0; // numActivePartials padded to the kernel granularity
+
+    const Kernels::ResonatorKernelTable* kernels = &Kernels::getSSE2Kernels();
 };
 
 } // namespace NEURONiK::DSP::Core
@@ -13,8 +13,10 @@
 
 #include <juce_core/juce_core.h>
 #include <array>
-#include <immintrin.h>
 #include "../../Common/SpectralModel.h"
+#include "ModelBank.h"
+#include "MorphCache.h"
+#include "ResonatorKernels.h"
 
 namespace NEURONiK::DSP::Core {
 
@@ -43,11 +45,36 @@ public:
 
     void setSampleRate(double sr) noexcept;
     void setBaseFrequency(float hz) noexcept;
-    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) noexcept;
+    /** Standalone use: replaces one slot in a bank private to this instance. Allocates. */
+    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot);
+
+    /** Points the bank at shared models (owned by the engine, never null); nothing is copied. */
+    void setModelBank(const ModelBank* bank) noexcept;
+
+    /** Sine in slot A, the other slots silent; shared by every ResonatorBank. */
+    static const ModelBank::Ptr& getDefaultModelBank();
+
+    /** Shares the morph with other voices (owned by the engine); nullptr computes it locally. */
+    void setMorphCache(MorphCache* cache) noexcept;
+
+    /**
+     * Filter topology of the bank:
+     * - Biquad: RBJ band-pass biquads (the original Neurotik sound).
+     * - Modal:  complex one-pole rotators with an exponential decay per mode,
+     *           fewer multiplies per sample, unconditionally stable under fast
+     *           frequency changes; weak partials of the model ring shorter.
+     * Both are normalized to a 0 dB peak per partial.
+     */
+    enum class Mode { Biquad, Modal };
+
+    /** Switches topology; clears the filter state and forces a coefficient update. */
+    void setMode(Mode newMode) noexcept;
+    Mode getMode() const noexcept { return mode; }
 
     // --- Real-time safe processing ---
     /** 
-     * Updates all 64 filters' coefficients. 
+     * Updates all 64 filters' coefficients (plus the unison layer) through the
+     * SIMD bankCoefficients / modalCoefficients kernel, so no sin/cos is called per filter.
      * Resonance is normalized 0.0 to 1.0 (mapped inside).
      */
     void updateParameters(float morphX, float morphY, float resonance, float detune) noexcept;
@@ -57,10 +84,15 @@ public:
 
     const std::array<float, 64>& getPartialAmplitudes() const noexcept { return partialAmplitudes; }
 
+    /** Name of the SIMD kernel variant picked for this CPU by setSampleRate(). */
+    const char* getKernelName() const noexcept { return kernels->name; }
+
 private:
     std::array<ResonatorBiquad, 128> resonators;
     std::array<float, 64> partialAmplitudes;
-    std::array<NEURONiK::Common::SpectralModel, 4> models;
+    const ModelBank* modelBank = nullptr;
+    ModelBank::Ptr ownModelBank; // only set by loadModel()
+    MorphCache* morphCache = nullptr;
 
     float baseFrequency = 440.0f;
     double sampleRate = 48000.0;
@@ -71,12 +103,22 @@ private:
     float lastRes = -1.0f, lastDetune = -1.0f;
     float lastBaseFreq = -1.0f;
     bool modelChanged = true;
-
-    // SIMD Buffers (Aligned for SSE 128-bit)
-    alignas(16) float b0_v[128] = {0}, b1_v[128] = {0}, b2_v[128] = {0};
-    alignas(16) float a1_v[128] = {0}, a2_v[128] = {0};
-    alignas(16) float z1_v[128] = {0}, z2_v[128] = {0};
-    alignas(16) float partialAmplitudes_v[128] = {0};
+    Mode mode = Mode::Biquad;
+
+    // SIMD Buffers (64-byte aligned for the widest kernel)
+    alignas(64) float omega_v[128] = {0}; // centre frequencies in radians/sample, 0 = disabled
+    alignas(64) float b0_v[128] = {0}, b2_v[128] = {0}; // b1 is always 0 for the band-pass
+    alignas(64) float a1_v[128] = {0}, a2_v[128] = {0};
+    alignas(64) float z1_v[128] = {0}, z2_v[128] = {0};
+    alignas(64) float partialAmplitudes_v[128] = {0};
+
+    // Modal mode: per-mode damping (see modalCoefficients), rotator and state
+    alignas(64) float modalDamping_v[128] = {0};
+    alignas(64) float modalCos_v[128] = {0}, modalSin_v[128] = {0};
+    alignas(64) float modalRe_v[128] = {0}, modalIm_v[128] = {0};
+    alignas(64) float modalGain_v[128] = {0};
+
+    const Kernels::ResonatorKernelTable* kernels = &Kernels::getSSE2Kernels();
 };
 
 } // namespace NEURONiK::DSP::Core
@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    ResonatorKernels.cpp
+    Created: 16 Oct 2026
+    Description: CPUID-based selection of the resonator kernel variant.
+
+  ==============================================================================
+*/
+
+#include "ResonatorKernels.h"
+#include <juce_core/juce_core.h>
+
+namespace NEURONiK::DSP::Core::Kernels {
+
+static const ResonatorKernelTable& detectResonatorKernels() noexcept
+{
+    // Optional cap for A/B testing on machines that support wider kernels
+    const auto requested = juce::SystemStats::getEnvironmentVariable("NEURONIK_KERNEL", {}).toLowerCase();
+    const bool allowAVX512 = requested.isEmpty() || requested == "avx512";
+    const bool allowAVX2 = allowAVX512 || requested == "avx2";
+
+    if (allowAVX512 && juce::SystemStats::hasAVX512F())
+        return getAVX512Kernels();
+
+    if (allowAVX2 && juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3())
+        return getAVX2Kernels();
+
+    return getSSE2Kernels();
+}
+
+const ResonatorKernelTable& selectResonatorKernels() noexcept
+{
+    // CPUID does not change at runtime: detect once, then every prepare() is a load
+    static const ResonatorKernelTable& selected = detectResonatorKernels();
+    return selected;
+}
+
+} // namespace NEURONiK::DSP::Core::Kernels
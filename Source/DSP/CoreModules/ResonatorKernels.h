@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    ResonatorKernels.h
+    Created: 16 Oct 2026
+    Description: Runtime-dispatched SIMD kernels (SSE2 / AVX2 / AVX-512) for the
+                 Resonator and ResonatorBank inner loops.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace NEURONiK::DSP::Core::Kernels {
+
+/**
+ * One set of kernels compiled for a specific instruction set.
+ * Each variant lives in its own translation unit built with the matching
+ * compiler flags; the best one supported by the running CPU is selected
+ * at prepare time.
+ *
+ * All arrays must be 64-byte aligned. numPartials must be a multiple of
+ * partialGranularity and numFilters a multiple of 64.
+ */
+struct ResonatorKernelTable
+{
+    const char* name;
+
+    /** Partials consumed per loop step (four registers); callers pad to this. */
+    int partialGranularity;
+
+    /** Advances every partial by one sample and returns the parabolic-sine sum. */
+    float (*renderSample)(float* phases, const float* increments, const float* amplitudes,
+                          int numPartials) noexcept;
+
+    /** Partial-major block render; overwrites out[0..numSamples). */
+    void (*renderBlock)(float* phases, const float* increments, const float* amplitudes,
+                        int numPartials, float* out, int numSamples) noexcept;
+
+    /**
+     * renderBlock with "roughness": every partial draws from its own xorshift32
+     * generator (noiseStates, one per partial) once per sample, using the low
+     * 16 bits to jitter its amplitude by up to +-amount/2 and the high 16 bits
+     * to jitter its phase by up to +-amount/5 of a cycle.
+     */
+    void (*renderBlockEntropy)(float* phases, const float* increments, const float* amplitudes,
+                               uint32_t* noiseStates, float amount, int numPartials,
+                               float* out, int numSamples) noexcept;
+
+    /** One sample of the band-pass biquad bank (b1 == 0), amplitude-weighted sum. */
+    float (*bankSample)(float excitation, const float* b0, const float* b2, const float* a1, const float* a2,
+                        float* z1, float* z2, const float* amplitudes, int numFilters) noexcept;
+
+    /**
+     * RBJ band-pass coefficients (b1 == 0) for numFilters centre frequencies
+     * given in radians per sample, without calling sin/cos. An omega of 0 marks
+     * a disabled filter and yields all-zero coefficients.
+     */
+    void (*bankCoefficients)(const float* omegas, float invTwoQ, float* b0, float* b2, float* a1, float* a2,
+                             int numFilters) noexcept;
+
+    /**
+     * One sample of the modal bank: every mode is a complex one-pole rotator
+     * (re + j*im) * r e^{jw} driven by the excitation; returns the gain-weighted
+     * sum of the imaginary parts. Four multiplies per mode, no feedforward taps.
+     */
+    float (*modalSample)(float excitation, const float* rotCos, const float* rotSin, float* re, float* im,
+                         const float* gains, int numModes) noexcept;
+
+    /**
+     * Rotator coefficients (r cos w, r sin w) and output gains for the modal
+     * bank, without sin/cos/exp calls. The pole radius follows from the
+     * per-mode damping; gains are the amplitudes scaled to a 0 dB peak. An
+     * omega of 0 disables a mode.
+     */
+    void (*modalCoefficients)(const float* omegas, const float* dampings, const float* amplitudes,
+                              float* rotCos, float* rotSin, float* gains, int numModes) noexcept;
+};
+
+const ResonatorKernelTable& getSSE2Kernels() noexcept;
+const ResonatorKernelTable& getAVX2Kernels() noexcept;
+const ResonatorKernelTable& getAVX512Kernels() noexcept;
+
+/**
+ * Returns the widest kernel set supported by this CPU (detected once via CPUID).
+ * The NEURONIK_KERNEL environment variable ("sse2", "avx2", "avx512") can cap
+ * the choice for A/B comparisons.
+ */
+const ResonatorKernelTable& selectResonatorKernels() noexcept;
+
+} // namespace NEURONiK::DSP::Core::Kernels
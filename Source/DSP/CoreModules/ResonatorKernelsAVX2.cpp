@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    ResonatorKernelsAVX2.cpp
+    Created: 16 Oct 2026
+    Description: 256-bit AVX2/FMA variant of the resonator kernels.
+                 Built with AVX2 + FMA code generation (see CMakeLists.txt);
+                 only called after CPUID confirms support.
+
+  ==============================================================================
+*/
+
+#include "ResonatorKernels.h"
+#include <immintrin.h>
+#include <cstdint>
+
+namespace NEURONiK::DSP::Core::Kernels {
+
+namespace AVX2 {
+
+struct Vec
+{
+    using Type = __m256;
+    using IntType = __m256i;
+    static constexpr int width = 8;
+
+    static inline Type zero() noexcept { return _mm256_setzero_ps(); }
+    static inline Type set1(float v) noexcept { return _mm256_set1_ps(v); }
+    static inline Type load(const float* p) noexcept { return _mm256_load_ps(p); }
+    static inline void store(float* p, Type v) noexcept { _mm256_store_ps(p, v); }
+    static inline Type add(Type a, Type b) noexcept { return _mm256_add_ps(a, b); }
+    static inline Type sub(Type a, Type b) noexcept { return _mm256_sub_ps(a, b); }
+    static inline Type mul(Type a, Type b) noexcept { return _mm256_mul_ps(a, b); }
+    static inline Type div(Type a, Type b) noexcept { return _mm256_div_ps(a, b); }
+    static inline Type sqrt(Type a) noexcept { return _mm256_sqrt_ps(a); }
+    static inline Type mulAdd(Type a, Type b, Type c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+    static inline Type abs(Type a) noexcept { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))); }
+
+    /** Returns value where a >= b, zero elsewhere. */
+    static inline Type maskGE(Type a, Type b, Type value) noexcept { return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ), value); }
+
+    static inline IntType loadInt(const uint32_t* p) noexcept { return _mm256_load_si256((const __m256i*) p); }
+    static inline void storeInt(uint32_t* p, IntType v) noexcept { _mm256_store_si256((__m256i*) p, v); }
+
+    /** One xorshift32 step (13, 17, 5) in every lane. */
+    static inline IntType xorshift(IntType s) noexcept
+    {
+        s = _mm256_xor_si256(s, _mm256_slli_epi32(s, 13));
+        s = _mm256_xor_si256(s, _mm256_srli_epi32(s, 17));
+        return _mm256_xor_si256(s, _mm256_slli_epi32(s, 5));
+    }
+
+    /** The low / high 16 bits of each lane as floats in [0, 65536). */
+    static inline Type lowBits(IntType v) noexcept { return _mm256_cvtepi32_ps(_mm256_and_si256(v, _mm256_set1_epi32(0xffff))); }
+    static inline Type highBits(IntType v) noexcept { return _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16)); }
+
+    static inline float hsum(Type v) noexcept
+    {
+        __m128 lo = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        __m128 shuf = _mm_movehdup_ps(lo);
+        __m128 sums = _mm_add_ps(lo, shuf);
+        shuf = _mm_movehl_ps(shuf, sums);
+        return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+    }
+};
+
+#include "ResonatorKernelsImpl.h"
+
+} // namespace AVX2
+
+const ResonatorKernelTable& getAVX2Kernels() noexcept
+{
+    static const ResonatorKernelTable table { "AVX2", 4 * AVX2::W, AVX2::renderSample, AVX2::renderBlock,
+                                              AVX2::renderBlockEntropy,
+                                              AVX2::bankSample, AVX2::bankCoefficients,
+                                              AVX2::modalSample, AVX2::modalCoefficients };
+    return table;
+}
+
+} // namespace NEURONiK::DSP::Core::Kernels
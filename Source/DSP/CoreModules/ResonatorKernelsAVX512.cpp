@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    ResonatorKernelsAVX512.cpp
+    Created: 16 Oct 2026
+    Description: 512-bit AVX-512F variant of the resonator kernels.
+                 Built with AVX-512F code generation (see CMakeLists.txt);
+                 only called after CPUID confirms support.
+
+  ==============================================================================
+*/
+
+#include "ResonatorKernels.h"
+#include <immintrin.h>
+#include <cstdint>
+
+namespace NEURONiK::DSP::Core::Kernels {
+
+namespace AVX512 {
+
+struct Vec
+{
+    using Type = __m512;
+    using IntType = __m512i;
+    static constexpr int width = 16;
+
+    static inline Type zero() noexcept { return _mm512_setzero_ps(); }
+    static inline Type set1(float v) noexcept { return _mm512_set1_ps(v); }
+    static inline Type load(const float* p) noexcept { return _mm512_load_ps(p); }
+    static inline void store(float* p, Type v) noexcept { _mm512_store_ps(p, v); }
+    static inline Type add(Type a, Type b) noexcept { return _mm512_add_ps(a, b); }
+    static inline Type sub(Type a, Type b) noexcept { return _mm512_sub_ps(a, b); }
+    static inline Type mul(Type a, Type b) noexcept { return _mm512_mul_ps(a, b); }
+    static inline Type div(Type a, Type b) noexcept { return _mm512_div_ps(a, b); }
+    static inline Type sqrt(Type a) noexcept { return _mm512_sqrt_ps(a); }
+    static inline Type mulAdd(Type a, Type b, Type c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+    static inline Type abs(Type a) noexcept { return _mm512_abs_ps(a); }
+
+    /** Returns value where a >= b, zero elsewhere. */
+    static inline Type maskGE(Type a, Type b, Type value) noexcept { return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(a, b, _CMP_GE_OQ), value); }
+
+    static inline IntType loadInt(const uint32_t* p) noexcept { return _mm512_load_si512(p); }
+    static inline void storeInt(uint32_t* p, IntType v) noexcept { _mm512_store_si512(p, v); }
+
+    /** One xorshift32 step (13, 17, 5) in every lane. */
+    static inline IntType xorshift(IntType s) noexcept
+    {
+        s = _mm512_xor_si512(s, _mm512_slli_epi32(s, 13));
+        s = _mm512_xor_si512(s, _mm512_srli_epi32(s, 17));
+        return _mm512_xor_si512(s, _mm512_slli_epi32(s, 5));
+    }
+
+    /** The low / high 16 bits of each lane as floats in [0, 65536). */
+    static inline Type lowBits(IntType v) noexcept { return _mm512_cvtepi32_ps(_mm512_and_si512(v, _mm512_set1_epi32(0xffff))); }
+    static inline Type highBits(IntType v) noexcept { return _mm512_cvtepi32_ps(_mm512_srli_epi32(v, 16)); }
+
+    static inline float hsum(Type v) noexcept { return _mm512_reduce_add_ps(v); }
+};
+
+#include "ResonatorKernelsImpl.h"
+
+} // namespace AVX512
+
+const ResonatorKernelTable& getAVX512Kernels() noexcept
+{
+    static const ResonatorKernelTable table { "AVX-512", 4 * AVX512::W, AVX512::renderSample, AVX512::renderBlock,
+                                              AVX512::renderBlockEntropy,
+                                              AVX512::bankSample, AVX512::bankCoefficients,
+                                              AVX512::modalSample, AVX512::modalCoefficients };
+    return table;
+}
+
+} // namespace NEURONiK::DSP::Core::Kernels
@@ -0,0 +1,345 @@
+/*
+  ==============================================================================
+
+    ResonatorKernelsImpl.h
+    Created: 16 Oct 2026
+    Description: ISA-independent body of the resonator kernels. Included by each
+                 ResonatorKernels<ISA>.cpp inside its own namespace, after that
+                 file has defined a `Vec` traits struct for its register width.
+
+                 Do not include this anywhere else: every inclusion must get its
+                 own namespace so the variants never share (ODR-merged) symbols.
+
+  ==============================================================================
+*/
+
+// No #pragma once: intentionally included once per ISA translation unit.
+
+constexpr int W = Vec::width;
+
+// One step of a bipolar phase accumulator (x in [-1, 1)) followed by the
+// parabolic sine 4 * x * (1 - |x|); the factor 4 is expected in amp.
+static inline Vec::Type advanceParabolic(Vec::Type& x, Vec::Type inc, Vec::Type amp) noexcept
+{
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+
+    x = Vec::add(x, inc);
+    x = Vec::sub(x, Vec::maskGE(x, one, two));
+
+    Vec::Type s = Vec::mul(x, Vec::sub(one, Vec::abs(x)));
+    return Vec::mul(s, amp);
+}
+
+static float renderSample(float* phases, const float* increments, const float* amplitudes,
+                          int numPartials) noexcept
+{
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+    const Vec::Type four = Vec::set1(4.0f);
+
+    Vec::Type sum = Vec::zero();
+
+    for (int i = 0; i < numPartials; i += W)
+    {
+        Vec::Type phase = Vec::add(Vec::load(&phases[i]), Vec::load(&increments[i]));
+
+        // Wrap phase [0, 1) using mask and subtraction
+        phase = Vec::sub(phase, Vec::maskGE(phase, one, one));
+        Vec::store(&phases[i], phase);
+
+        // Parabolic Sine: 4 * x * (1 - abs(x))
+        Vec::Type x = Vec::sub(Vec::mul(phase, two), one);
+        Vec::Type s = Vec::mul(four, Vec::mul(x, Vec::sub(one, Vec::abs(x))));
+
+        sum = Vec::mulAdd(s, Vec::load(&amplitudes[i]), sum);
+    }
+
+    return Vec::hsum(sum);
+}
+
+static void renderBlock(float* phases, const float* increments, const float* amplitudes,
+                        int numPartials, float* out, int numSamples) noexcept
+{
+    constexpr int maxChunk = 64;
+
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+    const Vec::Type four = Vec::set1(4.0f);
+    const Vec::Type half = Vec::set1(0.5f);
+
+    // acc[s] holds W partial sums for sample s (one per lane), reduced once at the end
+    alignas(64) float acc[maxChunk * W];
+
+    for (int start = 0; start < numSamples; start += maxChunk)
+    {
+        const int chunk = (numSamples - start < maxChunk) ? (numSamples - start) : maxChunk;
+
+        for (int s = 0; s < chunk; ++s)
+            Vec::store(&acc[s * W], Vec::zero());
+
+        // Four register groups in flight: independent phase chains hide the add latency
+        for (int i = 0; i < numPartials; i += 4 * W)
+        {
+            // Load once per chunk: bipolar phase (x = 2 * phase - 1), doubled increment,
+            // and the parabola's factor 4 folded into the amplitude
+            Vec::Type x0 = Vec::sub(Vec::mul(Vec::load(&phases[i]), two), one);
+            Vec::Type x1 = Vec::sub(Vec::mul(Vec::load(&phases[i + W]), two), one);
+            Vec::Type x2 = Vec::sub(Vec::mul(Vec::load(&phases[i + 2 * W]), two), one);
+            Vec::Type x3 = Vec::sub(Vec::mul(Vec::load(&phases[i + 3 * W]), two), one);
+            const Vec::Type inc0 = Vec::mul(Vec::load(&increments[i]), two);
+            const Vec::Type inc1 = Vec::mul(Vec::load(&increments[i + W]), two);
+            const Vec::Type inc2 = Vec::mul(Vec::load(&increments[i + 2 * W]), two);
+            const Vec::Type inc3 = Vec::mul(Vec::load(&increments[i + 3 * W]), two);
+            const Vec::Type amp0 = Vec::mul(Vec::load(&amplitudes[i]), four);
+            const Vec::Type amp1 = Vec::mul(Vec::load(&amplitudes[i + W]), four);
+            const Vec::Type amp2 = Vec::mul(Vec::load(&amplitudes[i + 2 * W]), four);
+            const Vec::Type amp3 = Vec::mul(Vec::load(&amplitudes[i + 3 * W]), four);
+
+            for (int s = 0; s < chunk; ++s)
+            {
+                Vec::Type sum01 = Vec::add(advanceParabolic(x0, inc0, amp0), advanceParabolic(x1, inc1, amp1));
+                Vec::Type sum23 = Vec::add(advanceParabolic(x2, inc2, amp2), advanceParabolic(x3, inc3, amp3));
+                Vec::store(&acc[s * W], Vec::add(Vec::load(&acc[s * W]), Vec::add(sum01, sum23)));
+            }
+
+            // Store once per chunk
+            Vec::store(&phases[i], Vec::mul(Vec::add(x0, one), half));
+            Vec::store(&phases[i + W], Vec::mul(Vec::add(x1, one), half));
+            Vec::store(&phases[i + 2 * W], Vec::mul(Vec::add(x2, one), half));
+            Vec::store(&phases[i + 3 * W], Vec::mul(Vec::add(x3, one), half));
+        }
+
+        // One horizontal reduction per sample for the whole chunk
+        for (int s = 0; s < chunk; ++s)
+            out[start + s] = Vec::hsum(Vec::load(&acc[s * W]));
+    }
+}
+
+// As advanceParabolic, with the increment and amplitude of this sample drawn
+// from the lane's generator: inc + high * incSlope, ampBase + low * ampSlope.
+// The phase may now step backwards, so it wraps in both directions.
+static inline Vec::Type advanceParabolicJittered(Vec::Type& x, Vec::IntType& state,
+                                                  Vec::Type inc, Vec::Type incSlope,
+                                                  Vec::Type ampBase, Vec::Type ampSlope) noexcept
+{
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type minusOne = Vec::set1(-1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+
+    state = Vec::xorshift(state);
+
+    x = Vec::add(x, Vec::mulAdd(Vec::highBits(state), incSlope, inc));
+    x = Vec::sub(x, Vec::maskGE(x, one, two));
+    x = Vec::add(x, Vec::maskGE(minusOne, x, two));
+
+    Vec::Type s = Vec::mul(x, Vec::sub(one, Vec::abs(x)));
+    return Vec::mul(s, Vec::mulAdd(Vec::lowBits(state), ampSlope, ampBase));
+}
+
+static void renderBlockEntropy(float* phases, const float* increments, const float* amplitudes,
+                               uint32_t* noiseStates, float amount, int numPartials,
+                               float* out, int numSamples) noexcept
+{
+    constexpr int maxChunk = 64;
+
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+    const Vec::Type half = Vec::set1(0.5f);
+
+    // A 16-bit draw r maps to the bipolar noise n = r / 32768 - 1. Amplitude:
+    // 4 * amp * (1 + n * amount / 2); bipolar phase step: 2 * (inc + n * amount / 5)
+    const Vec::Type ampBaseScale = Vec::set1(4.0f * (1.0f - amount * 0.5f));
+    const Vec::Type ampSlopeScale = Vec::set1(4.0f * amount * 0.5f / 32768.0f);
+    const Vec::Type incOffset = Vec::set1(-2.0f * amount * 0.2f);
+    const Vec::Type incSlope = Vec::set1(2.0f * amount * 0.2f / 32768.0f);
+
+    alignas(64) float acc[maxChunk * W];
+
+    for (int start = 0; start < numSamples; start += maxChunk)
+    {
+        const int chunk = (numSamples - start < maxChunk) ? (numSamples - start) : maxChunk;
+
+        for (int s = 0; s < chunk; ++s)
+            Vec::store(&acc[s * W], Vec::zero());
+
+        // Two register groups in flight: the generator state doubles the live registers
+        for (int i = 0; i < numPartials; i += 2 * W)
+        {
+            Vec::Type x0 = Vec::sub(Vec::mul(Vec::load(&phases[i]), two), one);
+            Vec::Type x1 = Vec::sub(Vec::mul(Vec::load(&phases[i + W]), two), one);
+            Vec::IntType state0 = Vec::loadInt(&noiseStates[i]);
+            Vec::IntType state1 = Vec::loadInt(&noiseStates[i + W]);
+            const Vec::Type inc0 = Vec::mulAdd(Vec::load(&increments[i]), two, incOffset);
+            const Vec::Type inc1 = Vec::mulAdd(Vec::load(&increments[i + W]), two, incOffset);
+            const Vec::Type amp0 = Vec::load(&amplitudes[i]);
+            const Vec::Type amp1 = Vec::load(&amplitudes[i + W]);
+            const Vec::Type ampBase0 = Vec::mul(amp0, ampBaseScale);
+            const Vec::Type ampBase1 = Vec::mul(amp1, ampBaseScale);
+            const Vec::Type ampSlope0 = Vec::mul(amp0, ampSlopeScale);
+            const Vec::Type ampSlope1 = Vec::mul(amp1, ampSlopeScale);
+
+            for (int s = 0; s < chunk; ++s)
+            {
+                Vec::Type sum = Vec::add(advanceParabolicJittered(x0, state0, inc0, incSlope, ampBase0, ampSlope0),
+                                         advanceParabolicJittered(x1, state1, inc1, incSlope, ampBase1, ampSlope1));
+                Vec::store(&acc[s * W], Vec::add(Vec::load(&acc[s * W]), sum));
+            }
+
+            Vec::store(&phases[i], Vec::mul(Vec::add(x0, one), half));
+            Vec::store(&phases[i + W], Vec::mul(Vec::add(x1, one), half));
+            Vec::storeInt(&noiseStates[i], state0);
+            Vec::storeInt(&noiseStates[i + W], state1);
+        }
+
+        for (int s = 0; s < chunk; ++s)
+            out[start + s] = Vec::hsum(Vec::load(&acc[s * W]));
+    }
+}
+
+static float bankSample(float excitation, const float* b0, const float* b2, const float* a1, const float* a2,
+                        float* z1, float* z2, const float* amplitudes, int numFilters) noexcept
+{
+    const Vec::Type input = Vec::set1(excitation);
+    Vec::Type sum = Vec::zero();
+
+    for (int i = 0; i < numFilters; i += W)
+    {
+        // out = b0 * in + z1
+        Vec::Type out = Vec::mulAdd(Vec::load(&b0[i]), input, Vec::load(&z1[i]));
+
+        // z1 = -a1 * out + z2 (since b1 is 0)
+        Vec::store(&z1[i], Vec::sub(Vec::load(&z2[i]), Vec::mul(Vec::load(&a1[i]), out)));
+
+        // z2 = b2 * in - a2 * out
+        Vec::store(&z2[i], Vec::sub(Vec::mul(Vec::load(&b2[i]), input), Vec::mul(Vec::load(&a2[i]), out)));
+
+        sum = Vec::mulAdd(out, Vec::load(&amplitudes[i]), sum);
+    }
+
+    return Vec::hsum(sum);
+}
+
+// sin(h) and cos(h) for h in [0, pi/2] as Taylor polynomials in h^2 (error
+// below 4e-8 over the range, i.e. at float precision)
+static inline Vec::Type sinHalfRange(Vec::Type h, Vec::Type h2) noexcept
+{
+    Vec::Type p = Vec::set1(-1.0f / 39916800.0f);
+    p = Vec::mulAdd(p, h2, Vec::set1(1.0f / 362880.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(-1.0f / 5040.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(1.0f / 120.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(-1.0f / 6.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(1.0f));
+    return Vec::mul(p, h);
+}
+
+static inline Vec::Type cosHalfRange(Vec::Type h2) noexcept
+{
+    Vec::Type p = Vec::set1(1.0f / 479001600.0f);
+    p = Vec::mulAdd(p, h2, Vec::set1(-1.0f / 3628800.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(1.0f / 40320.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(-1.0f / 720.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(1.0f / 24.0f));
+    p = Vec::mulAdd(p, h2, Vec::set1(-0.5f));
+    return Vec::mulAdd(p, h2, Vec::set1(1.0f));
+}
+
+static void bankCoefficients(const float* omegas, float invTwoQ, float* b0, float* b2, float* a1, float* a2,
+                             int numFilters) noexcept
+{
+    const Vec::Type zero = Vec::zero();
+    const Vec::Type half = Vec::set1(0.5f);
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+    const Vec::Type minusTwo = Vec::set1(-2.0f);
+    const Vec::Type invTwoQV = Vec::set1(invTwoQ);
+    const Vec::Type minOmega = Vec::set1(1.0e-6f);
+
+    for (int i = 0; i < numFilters; i += W)
+    {
+        const Vec::Type w = Vec::load(&omegas[i]);
+
+        // Work on the half angle and use the double-angle identities:
+        // cos(w) = 1 - 2 sin^2(w/2) keeps low, high-Q resonators accurate
+        const Vec::Type h = Vec::mul(w, half);
+        const Vec::Type h2 = Vec::mul(h, h);
+        const Vec::Type s = sinHalfRange(h, h2);
+        const Vec::Type c = cosHalfRange(h2);
+
+        const Vec::Type sinW = Vec::mul(two, Vec::mul(s, c));
+        const Vec::Type cosW = Vec::sub(one, Vec::mul(two, Vec::mul(s, s)));
+
+        // RBJ band-pass (constant 0 dB peak gain)
+        const Vec::Type alpha = Vec::mul(sinW, invTwoQV);
+        const Vec::Type invA0 = Vec::div(one, Vec::add(one, alpha));
+        const Vec::Type gain = Vec::mul(alpha, invA0);
+
+        // Disabled filters (omega == 0) get all-zero coefficients
+        Vec::store(&b0[i], Vec::maskGE(w, minOmega, gain));
+        Vec::store(&b2[i], Vec::maskGE(w, minOmega, Vec::sub(zero, gain)));
+        Vec::store(&a1[i], Vec::maskGE(w, minOmega, Vec::mul(Vec::mul(minusTwo, cosW), invA0)));
+        Vec::store(&a2[i], Vec::maskGE(w, minOmega, Vec::mul(Vec::sub(one, alpha), invA0)));
+    }
+}
+
+static float modalSample(float excitation, const float* rotCos, const float* rotSin, float* re, float* im,
+                         const float* gains, int numModes) noexcept
+{
+    const Vec::Type input = Vec::set1(excitation);
+    Vec::Type sum = Vec::zero();
+
+    for (int i = 0; i < numModes; i += W)
+    {
+        const Vec::Type c = Vec::load(&rotCos[i]);
+        const Vec::Type s = Vec::load(&rotSin[i]);
+        const Vec::Type x = Vec::load(&re[i]);
+        const Vec::Type y = Vec::load(&im[i]);
+
+        // (x + jy) * r e^{jw}, plus the excitation on the real part
+        const Vec::Type newIm = Vec::mulAdd(s, x, Vec::mul(c, y));
+        const Vec::Type newRe = Vec::sub(Vec::mulAdd(c, x, input), Vec::mul(s, y));
+
+        Vec::store(&re[i], newRe);
+        Vec::store(&im[i], newIm);
+
+        sum = Vec::mulAdd(newIm, Vec::load(&gains[i]), sum);
+    }
+
+    return Vec::hsum(sum);
+}
+
+static void modalCoefficients(const float* omegas, const float* dampings, const float* amplitudes,
+                              float* rotCos, float* rotSin, float* gains, int numModes) noexcept
+{
+    const Vec::Type half = Vec::set1(0.5f);
+    const Vec::Type one = Vec::set1(1.0f);
+    const Vec::Type two = Vec::set1(2.0f);
+    const Vec::Type minOmega = Vec::set1(1.0e-6f);
+
+    for (int i = 0; i < numModes; i += W)
+    {
+        const Vec::Type w = Vec::load(&omegas[i]);
+
+        const Vec::Type h = Vec::mul(w, half);
+        const Vec::Type h2 = Vec::mul(h, h);
+        const Vec::Type s = sinHalfRange(h, h2);
+        const Vec::Type c = cosHalfRange(h2);
+
+        const Vec::Type sinW = Vec::mul(two, Vec::mul(s, c));
+        const Vec::Type cosW = Vec::sub(one, Vec::mul(two, Vec::mul(s, s)));
+
+        // Pole radius r = 1 / (1 + w * damping): always inside the unit circle,
+        // close to exp(-bandwidth / 2) for narrow modes
+        const Vec::Type r = Vec::div(one, Vec::mulAdd(w, Vec::load(&dampings[i]), one));
+        const Vec::Type rSin = Vec::mul(r, sinW);
+
+        // Peak gain of Im(y) is r sin w / ((1 - r) |1 - r e^{-2jw}|); normalize it to 1
+        const Vec::Type cos2W = Vec::sub(one, Vec::mul(two, Vec::mul(sinW, sinW)));
+        const Vec::Type distance = Vec::sqrt(Vec::add(Vec::sub(one, Vec::mul(two, Vec::mul(r, cos2W))), Vec::mul(r, r)));
+        const Vec::Type norm = Vec::div(Vec::mul(Vec::sub(one, r), distance), Vec::add(rSin, Vec::set1(1.0e-30f)));
+
+        Vec::store(&rotCos[i], Vec::maskGE(w, minOmega, Vec::mul(r, cosW)));
+        Vec::store(&rotSin[i], Vec::maskGE(w, minOmega, rSin));
+        Vec::store(&gains[i], Vec::maskGE(w, minOmega, Vec::mul(Vec::load(&amplitudes[i]), norm)));
+    }
+}
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    ResonatorKernelsSSE2.cpp
+    Created: 16 Oct 2026
+    Description: 128-bit baseline variant of the resonator kernels.
+
+  ==============================================================================
+*/
+
+#include "ResonatorKernels.h"
+#include <immintrin.h>
+#include <cstdint>
+
+namespace NEURONiK::DSP::Core::Kernels {
+
+namespace SSE2 {
+
+struct Vec
+{
+    using Type = __m128;
+    using IntType = __m128i;
+    static constexpr int width = 4;
+
+    static inline Type zero() noexcept { return _mm_setzero_ps(); }
+    static inline Type set1(float v) noexcept { return _mm_set1_ps(v); }
+    static inline Type load(const float* p) noexcept { return _mm_load_ps(p); }
+    static inline void store(float* p, Type v) noexcept { _mm_store_ps(p, v); }
+    static inline Type add(Type a, Type b) noexcept { return _mm_add_ps(a, b); }
+    static inline Type sub(Type a, Type b) noexcept { return _mm_sub_ps(a, b); }
+    static inline Type mul(Type a, Type b) noexcept { return _mm_mul_ps(a, b); }
+    static inline Type div(Type a, Type b) noexcept { return _mm_div_ps(a, b); }
+    static inline Type sqrt(Type a) noexcept { return _mm_sqrt_ps(a); }
+    static inline Type mulAdd(Type a, Type b, Type c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline Type abs(Type a) noexcept { return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+
+    /** Returns value where a >= b, zero elsewhere. */
+    static inline Type maskGE(Type a, Type b, Type value) noexcept { return _mm_and_ps(_mm_cmpge_ps(a, b), value); }
+
+    static inline IntType loadInt(const uint32_t* p) noexcept { return _mm_load_si128((const __m128i*) p); }
+    static inline void storeInt(uint32_t* p, IntType v) noexcept { _mm_store_si128((__m128i*) p, v); }
+
+    /** One xorshift32 step (13, 17, 5) in every lane. */
+    static inline IntType xorshift(IntType s) noexcept
+    {
+        s = _mm_xor_si128(s, _mm_slli_epi32(s, 13));
+        s = _mm_xor_si128(s, _mm_srli_epi32(s, 17));
+        return _mm_xor_si128(s, _mm_slli_epi32(s, 5));
+    }
+
+    /** The low / high 16 bits of each lane as floats in [0, 65536). */
+    static inline Type lowBits(IntType v) noexcept { return _mm_cvtepi32_ps(_mm_and_si128(v, _mm_set1_epi32(0xffff))); }
+    static inline Type highBits(IntType v) noexcept { return _mm_cvtepi32_ps(_mm_srli_epi32(v, 16)); }
+
+    static inline float hsum(Type v) noexcept
+    {
+        __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 sums = _mm_add_ps(v, shuf);
+        shuf = _mm_movehl_ps(shuf, sums);
+        return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+    }
+};
+
+#include "ResonatorKernelsImpl.h"
+
+} // namespace SSE2
+
+const ResonatorKernelTable& getSSE2Kernels() noexcept
+{
+    static const ResonatorKernelTable table { "SSE2", 4 * SSE2::W, SSE2::renderSample, SSE2::renderBlock,
+                                              SSE2::renderBlockEntropy,
+                                              SSE2::bankSample, SSE2::bankCoefficients,
+                                              SSE2::modalSample, SSE2::modalCoefficients };
+    return table;
+}
+
+} // namespace NEURONiK::DSP::Core::Kernels
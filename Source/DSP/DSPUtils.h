@@ -16,6 +16,10 @@
 #include <cmath>
 #include <limits>
 
+#if JUCE_INTEL
+ #include <immintrin.h>
+#endif
+
 namespace NEURONiK::DSP {
 
 /**
@@ -68,4 +72,33 @@ inline bool sanitizeAudioBuffer(juce::AudioBuffer<float>& buffer, int startSampl
     return foundInvalid;
 }
 
+/**
+ * Returns false if any sample is NaN or Infinity. Read-only, and only looks at
+ * the exponent bits (all ones for both), so a clean block costs one SIMD pass.
+ */
+inline bool isBlockFinite(const float* data, int numSamples) noexcept
+{
+    int i = 0;
+
+   #if JUCE_INTEL
+    const __m128i exponentMask = _mm_set1_epi32(0x7f800000);
+    __m128i invalid = _mm_setzero_si128();
+
+    for (; i + 4 <= numSamples; i += 4)
+    {
+        const __m128i exponent = _mm_and_si128(_mm_castps_si128(_mm_loadu_ps(data + i)), exponentMask);
+        invalid = _mm_or_si128(invalid, _mm_cmpeq_epi32(exponent, exponentMask));
+    }
+
+    if (_mm_movemask_epi8(invalid) != 0)
+        return false;
+   #endif
+
+    for (; i < numSamples; ++i)
+        if (!std::isfinite(data[i]))
+            return false;
+
+    return true;
+}
+
 } // namespace NEURONiK::DSP
@@ -11,23 +11,33 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
-#include <vector>
+#include <immintrin.h>
+#include <cmath>
+#include "DelayLine.h"
 
 namespace NEURONiK::DSP::Effects {
 
+/**
+ * Stereo chorus on a StereoDelayLine with cubic interpolation, processed in
+ * chunks: the LFO sine is rotated four samples at a time from the chunk start
+ * (two sin/cos pairs per chunk instead of one std::sin per sample), and the
+ * smoothed parameters are linear ramps across the chunk.
+ *
+ * Thread-safety: processBlock is real-time safe.
+ */
 class Chorus
 {
 public:
-    Chorus() : delayBuffer(2, 4096)
+    Chorus()
     {
-        delayBuffer.clear();
+        line.setInterpolation(StereoDelayLine::Interpolation::Cubic);
+        line.prepare(4096, chunkSize);
     }
 
     void prepare(double sampleRate)
     {
         currentSampleRate = sampleRate;
-        delayBuffer.setSize(2, static_cast<int>(sampleRate * 0.1)); // 100ms max delay
-        delayBuffer.clear();
+        line.prepare(static_cast<int>(sampleRate * 0.1), chunkSize); // 100ms max delay
         phase = 0.0f;
 
         rateSmoother.reset(sampleRate, 0.02);
@@ -51,61 +61,121 @@ public:
     {
         const int numChannels = buffer.getNumChannels();
         const int numSamples = buffer.getNumSamples();
-        const int bufferSize = delayBuffer.getNumSamples();
+        if (numChannels == 0)
+            return;
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            float currentRate = rateSmoother.getNextValue();
-            float currentDepth = depthSmoother.getNextValue();
-            float currentMix = mixSmoother.getNextValue();
+        const float sampleRate = static_cast<float>(currentSampleRate);
 
-            float phaseInc = juce::MathConstants<float>::twoPi * currentRate / static_cast<float>(currentSampleRate);
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int n = juce::jmin(chunkSize, numSamples - start);
+            float* left = buffer.getWritePointer(0, start);
+            float* right = buffer.getWritePointer(juce::jmin(1, numChannels - 1), start);
 
-            // Modulation: LFO between 5ms and 30ms
-            float mod = (std::sin(phase) + 1.0f) * 0.5f; // 0 to 1
-            float delaySamples = (0.005f + mod * 0.025f * currentDepth) * static_cast<float>(currentSampleRate);
+            // The rate is held per chunk at its mean, so the phase advances as with a per-sample ramp
+            const float firstRate = rateSmoother.getCurrentValue();
+            const float currentRate = 0.5f * (firstRate + rateSmoother.skip(n));
+            const float phaseInc = juce::MathConstants<float>::twoPi * currentRate / sampleRate;
 
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                float inputSample = buffer.getReadPointer(channel)[sample];
+            fillSmoothedRamp(depthSmoother, depthRamp, n);
+            fillSmoothedRamp(mixSmoother, mixRamp, n);
 
-                // Write input to delay buffer
-                delayBuffer.setSample(channel % 2, writePos, inputSample);
+            // Dry chunks only keep the line filled, so a rising mix starts from real history
+            const bool dry = mixRamp[0] == 0.0f && mixRamp[n - 1] == 0.0f;
 
-                // Read modulated position
-                float readPos = static_cast<float>(writePos) - delaySamples;
-                if (readPos < 0) readPos += static_cast<float>(bufferSize);
-
-                int index1 = static_cast<int>(readPos);
-                int index2 = (index1 + 1) % bufferSize;
-                float fraction = readPos - static_cast<float>(index1);
+            if (!dry)
+            {
+                computeDelays(phaseInc, n);
+                line.read(delayRamp, wetLeft, wetRight, n);
+            }
 
-                float delayedSample = (1.0f - fraction) * delayBuffer.getSample(channel % 2, index1) +
-                                      fraction * delayBuffer.getSample(channel % 2, index2);
+            line.write(left, right, n);
 
-                // Mix
-                float output = (inputSample * (1.0f - currentMix * 0.5f)) + (delayedSample * currentMix * 0.5f);
-                buffer.getWritePointer(channel)[sample] = output;
-            }
+            phase += phaseInc * (float)n;
+            while (phase >= juce::MathConstants<float>::twoPi)
+                phase -= juce::MathConstants<float>::twoPi;
 
-            phase += phaseInc;
-            if (phase >= juce::MathConstants<float>::twoPi) phase -= juce::MathConstants<float>::twoPi;
+            if (dry)
+                continue;
 
-            if (++writePos >= bufferSize) writePos = 0;
+            // Mix: input * (1 - mix / 2) + delayed * mix / 2
+            mixInto(left, wetLeft, n);
+            if (right != left)
+                mixInto(right, wetRight, n);
         }
     }
 
     void reset()
     {
-        delayBuffer.clear();
+        line.reset();
         rateSmoother.setCurrentAndTargetValue(rateSmoother.getTargetValue());
         depthSmoother.setCurrentAndTargetValue(depthSmoother.getTargetValue());
         mixSmoother.setCurrentAndTargetValue(mixSmoother.getTargetValue());
     }
 
 private:
-    juce::AudioBuffer<float> delayBuffer;
-    int writePos = 0;
+    static constexpr int chunkSize = 64;
+
+    /**
+     * Delay per sample of the chunk: LFO between 5ms and 30ms. The sine runs
+     * four samples per step, each lane rotated by 4 * phaseInc, so the chunk
+     * needs one sin/cos pair for the phase and one for the increment.
+     */
+    void computeDelays(float phaseInc, int n) noexcept
+    {
+        const float sinInc = std::sin(phaseInc), cosInc = std::cos(phaseInc);
+        alignas(16) float laneSin[4], laneCos[4];
+        laneSin[0] = std::sin(phase);
+        laneCos[0] = std::cos(phase);
+        for (int k = 1; k < 4; ++k)
+        {
+            laneSin[k] = laneSin[k - 1] * cosInc + laneCos[k - 1] * sinInc;
+            laneCos[k] = laneCos[k - 1] * cosInc - laneSin[k - 1] * sinInc;
+        }
+
+        const float sin2 = 2.0f * sinInc * cosInc, cos2 = cosInc * cosInc - sinInc * sinInc;
+        const __m128 sinStep = _mm_set1_ps(2.0f * sin2 * cos2);
+        const __m128 cosStep = _mm_set1_ps(cos2 * cos2 - sin2 * sin2);
+
+        __m128 lfoSin = _mm_load_ps(laneSin);
+        __m128 lfoCos = _mm_load_ps(laneCos);
+
+        const float sampleRate = static_cast<float>(currentSampleRate);
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 minDelay = _mm_set1_ps(0.005f * sampleRate);
+        const __m128 depthScale = _mm_set1_ps(0.025f * sampleRate);
+        const __m128 shortest = _mm_set1_ps(StereoDelayLine::getMinimumDelay(n));
+
+        // depthRamp/delayRamp have room for a whole last step
+        for (int i = 0; i < n; i += 4)
+        {
+            const __m128 mod = _mm_mul_ps(_mm_add_ps(lfoSin, _mm_set1_ps(1.0f)), half); // 0 to 1
+            const __m128 depth = _mm_mul_ps(_mm_load_ps(depthRamp + i), depthScale);
+            _mm_store_ps(delayRamp + i, _mm_max_ps(shortest, _mm_add_ps(minDelay, _mm_mul_ps(mod, depth))));
+
+            const __m128 nextSin = _mm_add_ps(_mm_mul_ps(lfoSin, cosStep), _mm_mul_ps(lfoCos, sinStep));
+            lfoCos = _mm_sub_ps(_mm_mul_ps(lfoCos, cosStep), _mm_mul_ps(lfoSin, sinStep));
+            lfoSin = nextSin;
+        }
+    }
+
+    /** io[i] += mix[i] / 2 * (wet[i] - io[i]) */
+    void mixInto(float* io, const float* wet, int n) const noexcept
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 dry = _mm_loadu_ps(io + i);
+            const __m128 amount = _mm_mul_ps(half, _mm_load_ps(mixRamp + i));
+            _mm_storeu_ps(io + i, _mm_add_ps(dry, _mm_mul_ps(amount, _mm_sub_ps(_mm_load_ps(wet + i), dry))));
+        }
+
+        for (; i < n; ++i)
+            io[i] += 0.5f * mixRamp[i] * (wet[i] - io[i]);
+    }
+
+    StereoDelayLine line;
     float phase = 0.0f;
     double currentSampleRate = 44100.0;
 
@@ -113,6 +183,12 @@ private:
     juce::LinearSmoothedValue<float> depthSmoother { 0.2f };
     juce::LinearSmoothedValue<float> mixSmoother { 0.0f };
 
+    alignas(16) float depthRamp[chunkSize] {};
+    alignas(16) float mixRamp[chunkSize] {};
+    alignas(16) float delayRamp[chunkSize] {};
+    alignas(16) float wetLeft[chunkSize] {};
+    alignas(16) float wetRight[chunkSize] {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Chorus)
 };
 
@@ -11,29 +11,32 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
-#include <vector>
+#include <immintrin.h>
+#include "DelayLine.h"
 
 namespace NEURONiK::DSP::Effects {
 
 /**
  * A simple stereo feedback delay.
  *
+ * Processed in chunks on a StereoDelayLine: the smoothed time and feedback
+ * are linear ramps across each chunk, so no smoother runs per sample.
+ *
  * Thread-safety: processBlock is real-time safe.
  */
 class Delay
 {
 public:
-    Delay() : delayBuffer(2, 96000) // Default 2s @ 48kHz
+    Delay()
     {
-        delayBuffer.clear();
+        line.prepare(96000, chunkSize); // Default 2s @ 48kHz
     }
 
     void prepare(double sampleRate, int maxDelaySamples)
     {
         currentSampleRate = sampleRate;
-        delayBuffer.setSize(2, maxDelaySamples + 1024);
-        delayBuffer.clear();
-        writePos = 0;
+        maxDelay = (float)maxDelaySamples;
+        line.prepare(maxDelaySamples, chunkSize);
 
         timeSmoother.reset(sampleRate, 0.05); // 50ms ramp for delay time to avoid pitch jumps
         feedbackSmoother.reset(sampleRate, 0.02); // 20ms ramp
@@ -50,54 +53,86 @@ public:
     {
         const int numChannels = buffer.getNumChannels();
         const int numSamples = buffer.getNumSamples();
-        const int bufferSize = delayBuffer.getNumSamples();
+        if (numChannels == 0)
+            return;
 
-        for (int sample = 0; sample < numSamples; ++sample)
+        for (int start = 0; start < numSamples; start += chunkSize)
         {
-            float currentDelay = timeSmoother.getNextValue();
-            float currentFB = feedbackSmoother.getNextValue();
-
-            for (int channel = 0; channel < numChannels; ++channel)
+            const int n = juce::jmin(chunkSize, numSamples - start);
+            float* left = buffer.getWritePointer(0, start);
+            float* right = buffer.getWritePointer(juce::jmin(1, numChannels - 1), start);
+
+            // Block-wise feedback needs the whole chunk to read already written
+            // frames, which only matters while the time ramps up from zero
+            const float shortest = StereoDelayLine::getMinimumDelay(n);
+            if (timeSmoother.isSmoothing())
             {
-                float inputSample = buffer.getReadPointer(channel)[sample];
-
-                // Read from delay buffer (Linear Interpolation)
-                float readPos = static_cast<float>(writePos) - currentDelay;
-                if (readPos < 0) readPos += static_cast<float>(bufferSize);
+                fillSmoothedRamp(timeSmoother, delayRamp, n);
+                for (int i = 0; i < n; ++i)
+                    delayRamp[i] = juce::jlimit(shortest, maxDelay, delayRamp[i]);
 
-                int index1 = static_cast<int>(readPos);
-                int index2 = (index1 + 1) % bufferSize;
-                float fraction = readPos - static_cast<float>(index1);
-
-                float delayedSample = (1.0f - fraction) * delayBuffer.getSample(channel % 2, index1) +
-                                      fraction * delayBuffer.getSample(channel % 2, index2);
+                line.read(delayRamp, wetLeft, wetRight, n);
+            }
+            else
+            {
+                line.read(juce::jlimit(shortest, maxDelay, timeSmoother.getCurrentValue()), wetLeft, wetRight, n);
+            }
 
-                // Write to delay buffer (Input + Feedback)
-                delayBuffer.setSample(channel % 2, writePos, inputSample + (delayedSample * currentFB));
+            fillSmoothedRamp(feedbackSmoother, feedbackRamp, n);
 
-                // Mix
-                buffer.getWritePointer(channel)[sample] += delayedSample * 0.5f;
-            }
+            // Write to delay buffer (Input + Feedback), then mix
+            feedAndMix(left, wetLeft, feedLeft, n);
+            if (right != left)
+                feedAndMix(right, wetRight, feedRight, n);
 
-            if (++writePos >= bufferSize) writePos = 0;
+            line.write(feedLeft, right != left ? feedRight : feedLeft, n);
         }
     }
 
     void reset()
     {
-        delayBuffer.clear();
+        line.reset();
         timeSmoother.setCurrentAndTargetValue(timeSmoother.getTargetValue());
         feedbackSmoother.setCurrentAndTargetValue(feedbackSmoother.getTargetValue());
     }
 
 private:
-    juce::AudioBuffer<float> delayBuffer;
-    int writePos = 0;
+    static constexpr int chunkSize = 64;
+
+    /** feed[i] = io[i] + feedback[i] * wet[i], then io[i] += wet[i] / 2 */
+    void feedAndMix(float* io, const float* wet, float* feed, int n) const noexcept
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 dry = _mm_loadu_ps(io + i);
+            const __m128 delayed = _mm_load_ps(wet + i);
+            _mm_store_ps(feed + i, _mm_add_ps(dry, _mm_mul_ps(_mm_load_ps(feedbackRamp + i), delayed)));
+            _mm_storeu_ps(io + i, _mm_add_ps(dry, _mm_mul_ps(half, delayed)));
+        }
+
+        for (; i < n; ++i)
+        {
+            feed[i] = io[i] + feedbackRamp[i] * wet[i];
+            io[i] += 0.5f * wet[i];
+        }
+    }
+
+    StereoDelayLine line;
     double currentSampleRate = 44100.0;
+    float maxDelay = 96000.0f;
 
     juce::LinearSmoothedValue<float> timeSmoother;
     juce::LinearSmoothedValue<float> feedbackSmoother;
 
+    alignas(16) float delayRamp[chunkSize] {};
+    alignas(16) float feedbackRamp[chunkSize] {};
+    alignas(16) float wetLeft[chunkSize] {};
+    alignas(16) float wetRight[chunkSize] {};
+    alignas(16) float feedLeft[chunkSize] {};
+    alignas(16) float feedRight[chunkSize] {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Delay)
 };
 
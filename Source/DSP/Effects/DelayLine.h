@@ -0,0 +1,296 @@
+/*
+  ==============================================================================
+
+    DelayLine.h
+    Created: 16 Oct 2026
+    Description: Stereo ring-buffer delay line with block read/write, shared by
+                 the delay and chorus effects.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <immintrin.h>
+#include <algorithm>
+#include <vector>
+
+namespace NEURONiK::DSP::Effects {
+
+/**
+ * Stereo delay line processed a block at a time:
+ * - left/right are stored interleaved, so one SSE load fetches both channels
+ *   of two neighbouring frames and every step serves both channels,
+ * - the ring length is a power of two (wraparound is a mask) with the first
+ *   frames mirrored past its end, so interpolation never wraps mid-read,
+ * - read() takes one delay per sample and interpolates linearly or with a
+ *   4-point Hermite curve (smoother for modulated delays).
+ *
+ * A block is read before it is written: read() sees the frames written by the
+ * previous write() calls, so every delay must be at least
+ * getMinimumDelay(numSamples).
+ *
+ * Thread-Safety:
+ * - prepare() allocates; everything else is Audio Thread only.
+ */
+class StereoDelayLine
+{
+public:
+    enum class Interpolation { Linear, Cubic };
+
+    StereoDelayLine() = default;
+
+    /** Sizes the ring for delays up to maxDelaySamples with blocks of up to maxBlockSize. */
+    void prepare(int maxDelaySamples, int maxBlockSize)
+    {
+        numFrames = juce::nextPowerOfTwo(maxDelaySamples + maxBlockSize + guardFrames + 1);
+        mask = numFrames - 1;
+        ring.assign((size_t)(2 * (numFrames + guardFrames)), 0.0f);
+        writePos = 0;
+    }
+
+    void reset() noexcept
+    {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+        writePos = 0;
+    }
+
+    void setInterpolation(Interpolation newInterpolation) noexcept { interpolation = newInterpolation; }
+
+    /** Shortest delay a block of numSamples may read. */
+    static constexpr float getMinimumDelay(int numSamples) noexcept { return (float)numSamples + 2.0f; }
+
+    /**
+     * Reads numSamples frames; sample i is delays[i] samples older than the
+     * i-th sample of the next write() block.
+     */
+    void read(const float* delays, float* left, float* right, int numSamples) const noexcept
+    {
+        if (interpolation == Interpolation::Cubic)
+            readBlock<true>(delays, left, right, numSamples);
+        else
+            readBlock<false>(delays, left, right, numSamples);
+    }
+
+    /** Like read() with every sample delayed by the same amount, which saves the per-sample indexing. */
+    void read(float delay, float* left, float* right, int numSamples) const noexcept
+    {
+        if (interpolation == Interpolation::Cubic)
+            readFixedBlock<true>(delay, left, right, numSamples);
+        else
+            readFixedBlock<false>(delay, left, right, numSamples);
+    }
+
+    /** Appends numSamples frames. right may equal left for a mono source. */
+    void write(const float* left, const float* right, int numSamples) noexcept
+    {
+        float* data = ring.data();
+        int done = 0;
+
+        while (done < numSamples)
+        {
+            // Contiguous run up to the end of the ring
+            const int length = juce::jmin(numSamples - done, numFrames - writePos);
+            float* dest = data + 2 * writePos;
+            const float* l = left + done;
+            const float* r = right + done;
+
+            int i = 0;
+            for (; i + 4 <= length; i += 4)
+            {
+                const __m128 vl = _mm_loadu_ps(l + i);
+                const __m128 vr = _mm_loadu_ps(r + i);
+                _mm_storeu_ps(dest + 2 * i, _mm_unpacklo_ps(vl, vr));
+                _mm_storeu_ps(dest + 2 * i + 4, _mm_unpackhi_ps(vl, vr));
+            }
+
+            for (; i < length; ++i)
+            {
+                dest[2 * i] = l[i];
+                dest[2 * i + 1] = r[i];
+            }
+
+            done += length;
+            writePos = (writePos + length) & mask;
+        }
+
+        // Keep the mirrored frames in step with the start of the ring
+        std::copy(data, data + 2 * guardFrames, data + 2 * numFrames);
+    }
+
+private:
+    // Frames mirrored past the end: a cubic read touches 4 frames from its base,
+    // and the fixed-delay read may run a partial step of 4 samples past the ring end
+    static constexpr int guardFrames = 7;
+
+    /**
+     * Both channels of two samples, [L a, R a, L b, R b], each interpolated
+     * from the frames starting at frameA/frameB (the read point lies t past the
+     * first frame for linear, past the second for cubic).
+     */
+    template <bool cubic>
+    static __m128 interpolatePair(const float* frameA, const float* frameB, __m128 t) noexcept
+    {
+        const __m128 pa = _mm_loadu_ps(frameA);
+        const __m128 pb = _mm_loadu_ps(frameB);
+
+        if constexpr (cubic)
+        {
+            const __m128 qa = _mm_loadu_ps(frameA + 4);
+            const __m128 qb = _mm_loadu_ps(frameB + 4);
+
+            const __m128 xm1 = _mm_shuffle_ps(pa, pb, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m128 x0 = _mm_shuffle_ps(pa, pb, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m128 x1 = _mm_shuffle_ps(qa, qb, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m128 x2 = _mm_shuffle_ps(qa, qb, _MM_SHUFFLE(3, 2, 3, 2));
+
+            // 4-point, 3rd-order Hermite
+            const __m128 half = _mm_set1_ps(0.5f);
+            const __m128 c1 = _mm_mul_ps(half, _mm_sub_ps(x1, xm1));
+            const __m128 c2 = _mm_sub_ps(_mm_add_ps(xm1, _mm_add_ps(x1, x1)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.5f), x0), _mm_mul_ps(half, x2)));
+            const __m128 c3 = _mm_add_ps(_mm_mul_ps(half, _mm_sub_ps(x2, xm1)),
+                                         _mm_mul_ps(_mm_set1_ps(1.5f), _mm_sub_ps(x0, x1)));
+
+            __m128 v = _mm_add_ps(_mm_mul_ps(c3, t), c2);
+            v = _mm_add_ps(_mm_mul_ps(v, t), c1);
+            return _mm_add_ps(_mm_mul_ps(v, t), x0);
+        }
+        else
+        {
+            const __m128 x0 = _mm_shuffle_ps(pa, pb, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m128 x1 = _mm_shuffle_ps(pa, pb, _MM_SHUFFLE(3, 2, 3, 2));
+            return _mm_add_ps(x0, _mm_mul_ps(t, _mm_sub_ps(x1, x0)));
+        }
+    }
+
+    /** Splits two interleaved pairs into count samples of left and right. */
+    static void storeFour(__m128 y01, __m128 y23, float* left, float* right, int count) noexcept
+    {
+        const __m128 l = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 r = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        if (count == 4)
+        {
+            _mm_storeu_ps(left, l);
+            _mm_storeu_ps(right, r);
+            return;
+        }
+
+        alignas(16) float outL[4], outR[4];
+        _mm_store_ps(outL, l);
+        _mm_store_ps(outR, r);
+        for (int k = 0; k < count; ++k)
+        {
+            left[k] = outL[k];
+            right[k] = outR[k];
+        }
+    }
+
+    template <bool cubic>
+    void readBlock(const float* delays, float* left, float* right, int numSamples) const noexcept
+    {
+        const float* data = ring.data();
+
+        jassert(numSamples == 0 || *std::min_element(delays, delays + numSamples) >= getMinimumDelay(numSamples));
+
+        // Sample i reads frame writePos + i - delays[i]. With back = delays[i] - i,
+        // q = floor(back) and f = back - q, that is frame writePos - q - 1 plus a
+        // fraction t = 1 - f towards the next one. The cubic read starts a frame earlier.
+        const __m128 ramp = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128i start = _mm_set1_epi32(writePos - (cubic ? 2 : 1));
+        const __m128i indexMask = _mm_set1_epi32(mask);
+
+        alignas(16) int base[4];
+        alignas(16) float t[4];
+
+        for (int i = 0; i < numSamples; i += 4)
+        {
+            const int count = juce::jmin(4, numSamples - i);
+            __m128 d;
+            if (count == 4)
+            {
+                d = _mm_loadu_ps(delays + i);
+            }
+            else
+            {
+                alignas(16) float tail[4];
+                for (int k = 0; k < 4; ++k)
+                    tail[k] = delays[i + juce::jmin(k, count - 1)];
+                d = _mm_load_ps(tail);
+            }
+
+            const __m128 back = _mm_sub_ps(d, _mm_add_ps(ramp, _mm_set1_ps((float)i)));
+            const __m128i q = _mm_cvttps_epi32(back); // back > 0, truncation is floor
+            const __m128 f = _mm_sub_ps(back, _mm_cvtepi32_ps(q));
+
+            _mm_store_si128((__m128i*) base, _mm_and_si128(_mm_sub_epi32(start, q), indexMask));
+            _mm_store_ps(t, _mm_sub_ps(one, f));
+
+            const __m128 t01 = _mm_setr_ps(t[0], t[0], t[1], t[1]);
+            const __m128 t23 = _mm_setr_ps(t[2], t[2], t[3], t[3]);
+            storeFour(interpolatePair<cubic>(data + 2 * base[0], data + 2 * base[1], t01),
+                      interpolatePair<cubic>(data + 2 * base[2], data + 2 * base[3], t23),
+                      left + i, right + i, count);
+        }
+    }
+
+    template <bool cubic>
+    void readFixedBlock(float delay, float* left, float* right, int numSamples) const noexcept
+    {
+        const float* data = ring.data();
+
+        jassert(delay >= getMinimumDelay(numSamples));
+
+        // Consecutive samples read consecutive frames with the same fraction
+        const int q = (int)delay;
+        const __m128 t = _mm_set1_ps(1.0f - (delay - (float)q));
+        int frame = (writePos - q - (cubic ? 2 : 1)) & mask;
+
+        int i = 0;
+        while (i < numSamples)
+        {
+            // The mirrored frames cover reads up to the end of the ring
+            const int length = juce::jmin(numSamples - i, numFrames - frame);
+            const float* p = data + 2 * frame;
+
+            for (int k = 0; k < length; k += 4)
+                storeFour(interpolatePair<cubic>(p + 2 * k, p + 2 * k + 2, t),
+                          interpolatePair<cubic>(p + 2 * k + 4, p + 2 * k + 6, t),
+                          left + i + k, right + i + k, juce::jmin(4, length - k));
+
+            i += length;
+            frame = (frame + length) & mask;
+        }
+    }
+
+    std::vector<float> ring;
+    int numFrames = 0;
+    int mask = 0;
+    int writePos = 0;
+    Interpolation interpolation = Interpolation::Linear;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StereoDelayLine)
+};
+
+/**
+ * Writes the next n values of a linear smoother to dest and advances it:
+ * the ramp is linear, so one skip() replaces n getNextValue() calls.
+ */
+inline void fillSmoothedRamp(juce::LinearSmoothedValue<float>& smoother, float* dest, int n) noexcept
+{
+    const float first = smoother.getCurrentValue();
+    if (!smoother.isSmoothing())
+    {
+        std::fill(dest, dest + n, first);
+        return;
+    }
+
+    const float step = (smoother.skip(n) - first) / (float)n;
+    for (int i = 0; i < n; ++i)
+        dest[i] = first + step * (float)(i + 1);
+}
+
+} // namespace NEURONiK::DSP::Effects
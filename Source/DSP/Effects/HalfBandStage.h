@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    HalfBandStage.h
+    Created: 16 Oct 2026
+    Description: Polyphase half-band FIR for one 2x oversampling step.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <immintrin.h>
+#include <cmath>
+#include <cstring>
+
+namespace NEURONiK::DSP::Effects {
+
+/**
+ * Linear-phase half-band lowpass (Kaiser-windowed sinc, 2 * branchTaps - 1
+ * taps) split into its two polyphase branches. In a half-band filter every
+ * other tap is zero and the centre tap is 1/2, so one branch is a plain delay
+ * and only the other needs multiplies:
+ * - upsample(): even outputs from the FIR branch, odd outputs delayed input,
+ * - downsample(): the FIR branch on the even inputs plus the delayed odd ones.
+ * The branch is symmetric, so each multiply serves two taps. Four outputs are
+ * computed per SSE step; both directions keep their own history, so one
+ * instance handles one channel going up and coming back down.
+ *
+ * Latency: branchTaps - 1 samples at the lower rate for the up/down round trip.
+ *
+ * Thread-Safety:
+ * - Audio Thread only.
+ */
+template <int branchTaps, int maxInputSamples>
+class HalfBandStage
+{
+public:
+    static_assert(branchTaps % 2 == 0, "The FIR branch of a half-band filter has an even number of taps");
+
+    static constexpr int latency = branchTaps - 1;
+
+    explicit HalfBandStage(double kaiserBeta) noexcept
+    {
+        // h[m] = sinc((m - centre) / 2) / 2 * window(m); the branch holds the even taps
+        constexpr int centre = branchTaps - 1;
+        auto besselI0 = [](double x)
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 32; ++k)
+            {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        };
+
+        double taps[branchTaps];
+        double sum = 0.0;
+        for (int j = 0; j < branchTaps; ++j)
+        {
+            const int m = 2 * j;
+            const double t = (m - centre) * 0.5;
+            const double r = (double)(m - centre) / (double)centre;
+            const double window = besselI0(kaiserBeta * std::sqrt(juce::jmax(0.0, 1.0 - r * r))) / besselI0(kaiserBeta);
+            taps[j] = 0.5 * std::sin(juce::MathConstants<double>::pi * t) / (juce::MathConstants<double>::pi * t) * window;
+            sum += taps[j];
+        }
+
+        // Normalize to unity DC gain: the branch sums to 1/2, the centre tap is the other half
+        for (int j = 0; j < halfTaps; ++j)
+        {
+            const float down = (float)(taps[j] * 0.5 / sum);
+            downCoefficients[j] = _mm_set1_ps(down);
+            upCoefficients[j] = _mm_set1_ps(2.0f * down); // zero stuffing halves the level
+        }
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::memset(upHistory, 0, sizeof(upHistory));
+        std::memset(evenHistory, 0, sizeof(evenHistory));
+        std::memset(oddHistory, 0, sizeof(oddHistory));
+    }
+
+    /** Writes 2 * numSamples samples to out. in and out must not overlap. */
+    void upsample(const float* in, float* out, int numSamples) noexcept
+    {
+        jassert(numSamples <= maxInputSamples);
+
+        // x[i - k] lives at upHistory[branchTaps - 1 + i - k]
+        float* x = upHistory;
+        std::memcpy(x + branchTaps - 1, in, sizeof(float) * (size_t)numSamples);
+
+        const int vectorEnd = numSamples & ~3;
+
+        int i = 0;
+        for (; i < vectorEnd; i += 4)
+        {
+            const __m128 even = branch(x + i, upCoefficients);
+            const __m128 odd = _mm_loadu_ps(x + i + halfTaps);
+
+            _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(even, odd));
+            _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(even, odd));
+        }
+
+        for (; i < numSamples; ++i)
+        {
+            out[2 * i] = branchScalar(x + i, upCoefficients);
+            out[2 * i + 1] = x[i + halfTaps];
+        }
+
+        std::memmove(x, x + numSamples, sizeof(float) * (branchTaps - 1));
+    }
+
+    /** Reads 2 * numSamples samples from in. in and out must not overlap. */
+    void downsample(const float* in, float* out, int numSamples) noexcept
+    {
+        jassert(numSamples <= maxInputSamples);
+
+        // Even inputs: delay line of the FIR branch; odd inputs: pure delay of halfTaps
+        float* even = evenHistory;
+        float* odd = oddHistory;
+
+        const int vectorEnd = numSamples & ~3;
+
+        int i = 0;
+        for (; i < vectorEnd; i += 4)
+        {
+            const __m128 a = _mm_loadu_ps(in + 2 * i);
+            const __m128 b = _mm_loadu_ps(in + 2 * i + 4);
+            _mm_storeu_ps(even + branchTaps - 1 + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(odd + halfTaps + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+
+        for (; i < numSamples; ++i)
+        {
+            even[branchTaps - 1 + i] = in[2 * i];
+            odd[halfTaps + i] = in[2 * i + 1];
+        }
+
+        const __m128 half = _mm_set1_ps(0.5f);
+
+        i = 0;
+        for (; i < vectorEnd; i += 4)
+            _mm_storeu_ps(out + i, _mm_add_ps(branch(even + i, downCoefficients),
+                                              _mm_mul_ps(half, _mm_loadu_ps(odd + i))));
+
+        for (; i < numSamples; ++i)
+            out[i] = branchScalar(even + i, downCoefficients) + 0.5f * odd[i];
+
+        std::memmove(even, even + numSamples, sizeof(float) * (branchTaps - 1));
+        std::memmove(odd, odd + numSamples, sizeof(float) * halfTaps);
+    }
+
+private:
+    static constexpr int halfTaps = branchTaps / 2;
+
+    // Four consecutive branch outputs; tap k and its mirror share coefficient k
+    static __m128 branch(const float* x, const __m128* coefficients) noexcept
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (int k = 0; k < halfTaps; ++k)
+        {
+            const __m128 pair = _mm_add_ps(_mm_loadu_ps(x + k), _mm_loadu_ps(x + branchTaps - 1 - k));
+            sum = _mm_add_ps(sum, _mm_mul_ps(coefficients[k], pair));
+        }
+        return sum;
+    }
+
+    static float branchScalar(const float* x, const __m128* coefficients) noexcept
+    {
+        float sum = 0.0f;
+        for (int k = 0; k < halfTaps; ++k)
+            sum += _mm_cvtss_f32(coefficients[k]) * (x[k] + x[branchTaps - 1 - k]);
+        return sum;
+    }
+
+    __m128 upCoefficients[halfTaps];   // broadcast, one vector per tap pair
+    __m128 downCoefficients[halfTaps];
+
+    float upHistory[branchTaps - 1 + maxInputSamples];
+    float evenHistory[branchTaps - 1 + maxInputSamples];
+    float oddHistory[halfTaps + maxInputSamples];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HalfBandStage)
+};
+
+} // namespace NEURONiK::DSP::Effects
@@ -3,7 +3,7 @@
 
     Reverb.h
     Created: 26 Jan 2026
-    Description: Wrapper for JUCE standard Reverb.
+    Description: Feedback delay network reverb.
 
   ==============================================================================
  */
@@ -11,21 +11,55 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <immintrin.h>
+#include <cmath>
+#include <vector>
+#include "DelayLine.h"
 
 namespace NEURONiK::DSP::Effects {
 
+/**
+ * Stereo reverb built as a feedback delay network: 8 or 16 delay lines whose
+ * outputs are damped, scaled for the decay time and mixed back into every
+ * line through a Hadamard matrix. Four lines share one SSE vector, so a sample
+ * of the whole network is a handful of vector operations:
+ * - the matrix is a 4-point Hadamard inside each vector followed by
+ *   butterflies across the vectors, no multiplies,
+ * - the lines are longer than a chunk, so a chunk only reads frames written by
+ *   earlier chunks and the feedback is stored back once per chunk,
+ * - every line's delay is swept slowly by its own LFO (linear ramp per chunk)
+ *   to keep the modes from ringing metallic.
+ * Left feeds and reads the even lines, right the odd ones. The quality tier
+ * picks the line count: half the lines costs about half the CPU.
+ *
+ * Thread-safety: processBlock and setQuality are real-time safe.
+ */
 class Reverb
 {
 public:
-    Reverb() = default;
+    enum class Quality { Lines8 = 0, Lines16 };
+
+    Reverb()
+    {
+        prepare(44100.0);
+    }
 
     void prepare(double sampleRate)
     {
-        reverb.setSampleRate(sampleRate);
+        currentSampleRate = sampleRate;
+
+        // Every line of both tiers fits the same ring length
+        const int longest = static_cast<int>(std::ceil(delays16[maxLines - 1] * sampleRate / referenceRate));
+        ringSize = juce::nextPowerOfTwo(longest + static_cast<int>(std::ceil(modulationDepth * sampleRate)) + chunkSize + 2);
+        ring.assign((size_t)(maxLines * getLineStride()), 0.0f);
+
         sizeSmoother.reset(sampleRate, 0.02);
         dampingSmoother.reset(sampleRate, 0.02);
         widthSmoother.reset(sampleRate, 0.02);
         mixSmoother.reset(sampleRate, 0.02);
+
+        configureLines();
+        clearState();
     }
 
     void setParameters(float size, float damping, float width, float mix) noexcept
@@ -41,35 +75,59 @@ public:
         mixSmoother.setTargetValue(mix);
     }
 
+    /** Selects the line count; switching clears the tail. */
+    void setQuality(Quality newQuality) noexcept
+    {
+        if (newQuality == quality)
+            return;
+
+        quality = newQuality;
+        configureLines();
+        clearState();
+    }
+
+    Quality getQuality() const noexcept { return quality; }
+
     void processBlock(juce::AudioBuffer<float>& buffer)
     {
-        // Update parameters once per block (standard JUCE Reverb is block-based)
-        // For smoother transitions, we could process in smaller sub-blocks if needed, 
-        // but updating once per block is usually fine for Reverb unless the block is very large.
-        params.roomSize = sizeSmoother.getNextValue();
-        params.damping = dampingSmoother.getNextValue();
-        params.width = widthSmoother.getNextValue();
-        float mix = mixSmoother.getNextValue();
-        params.wetLevel = mix * 0.5f;
-        params.dryLevel = 1.0f - (mix * 0.2f);
-        
-        reverb.setParameters(params);
-
-        if (params.wetLevel <= 0.001f) return;
-
-        if (buffer.getNumChannels() == 1)
-        {
-            reverb.processMono(buffer.getWritePointer(0), buffer.getNumSamples());
-        }
-        else
+        const int numChannels = buffer.getNumChannels();
+        const int numSamples = buffer.getNumSamples();
+        if (numChannels == 0)
+            return;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
         {
-            reverb.processStereo(buffer.getWritePointer(0), buffer.getWritePointer(1), buffer.getNumSamples());
+            const int n = juce::jmin(chunkSize, numSamples - start);
+            float* left = buffer.getWritePointer(0, start);
+            float* right = buffer.getWritePointer(juce::jmin(1, numChannels - 1), start);
+
+            // Size, damping and width are held per chunk at their value at its end
+            const float size = sizeSmoother.skip(n);
+            const float damping = dampingSmoother.skip(n);
+            const float width = widthSmoother.skip(n);
+            fillSmoothedRamp(mixSmoother, mixRamp, n);
+
+            // Like the dry path of the old wrapper, an idle reverb does no work
+            if (mixRamp[0] <= 0.001f && mixRamp[n - 1] <= 0.001f)
+                continue;
+
+            if (size != decaySize)
+                updateLineGains(size);
+
+            interleave(left, right, n);
+
+            if (quality == Quality::Lines16)
+                processNetwork<4>(damping * 0.4f, n);
+            else
+                processNetwork<2>(damping * 0.4f, n);
+
+            mixInto(left, right, width, n);
         }
     }
 
     void reset()
     {
-        reverb.reset();
+        clearState();
         sizeSmoother.setCurrentAndTargetValue(sizeSmoother.getTargetValue());
         dampingSmoother.setCurrentAndTargetValue(dampingSmoother.getTargetValue());
         widthSmoother.setCurrentAndTargetValue(widthSmoother.getTargetValue());
@@ -77,8 +135,350 @@ public:
     }
 
 private:
-    juce::Reverb reverb;
-    juce::Reverb::Parameters params;
+    static constexpr int maxLines = 16;
+    static constexpr int chunkSize = 64;
+    static constexpr double referenceRate = 48000.0;
+    static constexpr float modulationDepth = 0.00015f; // seconds, about 7 samples at 48kHz
+
+    // Line lengths in samples at 48kHz: primes spread geometrically over 22-88ms and 24-80ms
+    static constexpr float delays16[maxLines] = { 1061, 1163, 1277, 1399, 1531, 1669, 1847, 2017,
+                                                  2213, 2423, 2663, 2917, 3203, 3511, 3851, 4229 };
+    static constexpr float delays8[maxLines / 2] = { 1153, 1367, 1627, 1931, 2293, 2719, 3229, 3847 };
+
+    int getNumLines() const noexcept { return quality == Quality::Lines16 ? 16 : 8; }
+
+    // Each ring is followed by a copy of its first sample, so an interpolating read never wraps
+    int getLineStride() const noexcept { return ringSize + 1; }
+
+    /** Lengths, LFOs and taps of the active tier. */
+    void configureLines() noexcept
+    {
+        const int lines = getNumLines();
+        const float rateScale = static_cast<float>(currentSampleRate / referenceRate);
+        const float depth = modulationDepth * static_cast<float>(currentSampleRate);
+
+        // The level through the network does not depend on the line count
+        const float inputScale = 0.7f / std::sqrt((float)lines);
+        const float outputScale = 1.0f;
+
+        for (int i = 0; i < lines; ++i)
+        {
+            baseDelay[i] = (lines == 16 ? delays16[i] : delays8[i]) * rateScale;
+
+            // 0.3 to 1.05 Hz, phases spread by the golden angle
+            const float rateHz = 0.3f + 0.75f * (float)i / (float)(lines - 1);
+            lfoIncrement[i] = juce::MathConstants<float>::twoPi * rateHz / static_cast<float>(currentSampleRate);
+            lfoPhase[i] = std::remainder(2.39996323f * (float)i, juce::MathConstants<float>::twoPi);
+            lineDelay[i] = baseDelay[i] + depth * std::sin(lfoPhase[i]);
+
+            inputGain[i] = ((i >> 1) & 1) != 0 ? -inputScale : inputScale;
+            outputTap[i] = ((i >> 2) & 1) != 0 ? -outputScale : outputScale;
+        }
+
+        updateLineGains(sizeSmoother.getCurrentValue());
+    }
+
+    /**
+     * Per-line gain for a decay time of 0.2s (size 0) to 9s (size 1), with
+     * the 1/sqrt(lines) that makes the Hadamard matrix orthonormal folded in.
+     */
+    void updateLineGains(float size) noexcept
+    {
+        decaySize = size;
+
+        const int lines = getNumLines();
+        const float decaySamples = 0.2f * std::pow(45.0f, size) * static_cast<float>(currentSampleRate);
+        const float normalize = 1.0f / std::sqrt((float)lines);
+
+        for (int i = 0; i < lines; ++i)
+            lineGain[i] = std::pow(10.0f, -3.0f * baseDelay[i] / decaySamples) * normalize;
+    }
+
+    void clearState() noexcept
+    {
+        std::fill(ring.begin(), ring.end(), 0.0f);
+        std::fill(std::begin(damped), std::end(damped), 0.0f);
+        writePos = 0;
+    }
+
+    /** Input frames as [L, R] pairs, so each sample broadcasts as [L, R, L, R]. */
+    void interleave(const float* left, const float* right, int n) noexcept
+    {
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 l = _mm_loadu_ps(left + i);
+            const __m128 r = _mm_loadu_ps(right + i);
+            _mm_store_ps(inputFrames + 2 * i, _mm_unpacklo_ps(l, r));
+            _mm_store_ps(inputFrames + 2 * i + 4, _mm_unpackhi_ps(l, r));
+        }
+
+        for (; i < n; ++i)
+        {
+            inputFrames[2 * i] = left[i];
+            inputFrames[2 * i + 1] = right[i];
+        }
+    }
+
+    /** 4-point Hadamard of [a, b, c, d]: two butterfly stages through shuffles. */
+    static __m128 hadamard4(__m128 v) noexcept
+    {
+        // Negation is a sign flip: [a, -b, c, -d] + [b, a, d, c], then the same on halves
+        const __m128 pairSigns = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+        const __m128 halfSigns = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+
+        v = _mm_add_ps(_mm_xor_ps(v, pairSigns), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(_mm_xor_ps(v, halfSigns), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    /** Unnormalized Hadamard across all lines: H4 within vectors, then across them. */
+    template <int groups>
+    static void hadamard(__m128* v) noexcept
+    {
+        for (int g = 0; g < groups; ++g)
+            v[g] = hadamard4(v[g]);
+
+        const __m128 a = _mm_add_ps(v[0], v[1]);
+        const __m128 b = _mm_sub_ps(v[0], v[1]);
+
+        if constexpr (groups == 2)
+        {
+            v[0] = a;
+            v[1] = b;
+        }
+        else
+        {
+            const __m128 c = _mm_add_ps(v[2], v[3]);
+            const __m128 d = _mm_sub_ps(v[2], v[3]);
+            v[0] = _mm_add_ps(a, c);
+            v[1] = _mm_add_ps(b, d);
+            v[2] = _mm_sub_ps(a, c);
+            v[3] = _mm_sub_ps(b, d);
+        }
+    }
+
+    /** sin(x) for x in [-pi, pi], parabolic approximation with one refinement (|error| < 0.001). */
+    static __m128 approximateSin(__m128 x) noexcept
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 b = _mm_set1_ps(4.0f / juce::MathConstants<float>::pi);
+        const __m128 c = _mm_set1_ps(-4.0f / (juce::MathConstants<float>::pi * juce::MathConstants<float>::pi));
+
+        const __m128 y = _mm_add_ps(_mm_mul_ps(b, x), _mm_mul_ps(c, _mm_mul_ps(x, _mm_andnot_ps(signMask, x))));
+        const __m128 refine = _mm_sub_ps(_mm_mul_ps(y, _mm_andnot_ps(signMask, y)), y);
+        return _mm_add_ps(y, _mm_mul_ps(_mm_set1_ps(0.225f), refine));
+    }
+
+    /** Runs n samples of a network of 4 * groups lines into outputFrames. */
+    template <int groups>
+    void processNetwork(float dampingCoefficient, int n) noexcept
+    {
+        constexpr int lines = 4 * groups;
+        const float* data = ring.data();
+
+        // Each line's delay ramps linearly to its LFO value at the end of the chunk.
+        // Sample t reads frame writePos + t - d(t); back(t) = d(t) - t is start + t * step.
+        const __m128 pi = _mm_set1_ps(juce::MathConstants<float>::pi);
+        const __m128 twoPi = _mm_set1_ps(juce::MathConstants<float>::twoPi);
+        const __m128 depth = _mm_set1_ps(modulationDepth * static_cast<float>(currentSampleRate));
+        const __m128 chunkLength = _mm_set1_ps((float)n);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        const int stride = getLineStride();
+        const __m128 damp = _mm_set1_ps(dampingCoefficient);
+        const __m128i newest = _mm_set1_epi32(writePos - 1);
+        const __m128i indexMask = _mm_set1_epi32(ringSize - 1);
+
+        alignas(16) int first[4];
+
+        // Pass 1, four lines at a time: read, tap, damp and scale for the decay
+        for (int g = 0; g < groups; ++g)
+        {
+            __m128 phase = _mm_add_ps(_mm_load_ps(lfoPhase + 4 * g), _mm_mul_ps(_mm_load_ps(lfoIncrement + 4 * g), chunkLength));
+            phase = _mm_sub_ps(phase, _mm_and_ps(_mm_cmpgt_ps(phase, pi), twoPi));
+            _mm_store_ps(lfoPhase + 4 * g, phase);
+
+            const __m128 target = _mm_add_ps(_mm_load_ps(baseDelay + 4 * g), _mm_mul_ps(depth, approximateSin(phase)));
+            const __m128 current = _mm_load_ps(lineDelay + 4 * g);
+            const __m128 slope = _mm_div_ps(_mm_sub_ps(target, current), chunkLength);
+            _mm_store_ps(lineDelay + 4 * g, target);
+
+            const __m128 start = _mm_add_ps(current, slope);
+            const __m128 step = _mm_sub_ps(slope, one);
+            const __m128i offset = _mm_setr_epi32(4 * g * stride, (4 * g + 1) * stride, (4 * g + 2) * stride, (4 * g + 3) * stride);
+            const __m128 gain = _mm_load_ps(lineGain + 4 * g);
+            const __m128 outTap = _mm_load_ps(outputTap + 4 * g);
+            __m128 lowpass = _mm_load_ps(damped + 4 * g);
+            __m128 time = _mm_setzero_ps();
+
+            for (int t = 0; t < n; ++t)
+            {
+                const __m128 back = _mm_add_ps(start, _mm_mul_ps(time, step));
+                const __m128i q = _mm_cvttps_epi32(back); // back > 0, truncation is floor
+                const __m128 fraction = _mm_sub_ps(one, _mm_sub_ps(back, _mm_cvtepi32_ps(q)));
+                time = _mm_add_ps(time, one);
+
+                const __m128i index = _mm_and_si128(_mm_sub_epi32(newest, q), indexMask);
+                _mm_store_si128((__m128i*) first, _mm_add_epi32(index, offset));
+
+                // Both interpolation points of a line in one 64-bit load
+                const __m128 pairs01 = _mm_loadh_pi(_mm_loadl_pi(one, (const __m64*)(data + first[0])), (const __m64*)(data + first[1]));
+                const __m128 pairs23 = _mm_loadh_pi(_mm_loadl_pi(one, (const __m64*)(data + first[2])), (const __m64*)(data + first[3]));
+                const __m128 x0 = _mm_shuffle_ps(pairs01, pairs23, _MM_SHUFFLE(2, 0, 2, 0));
+                const __m128 x1 = _mm_shuffle_ps(pairs01, pairs23, _MM_SHUFFLE(3, 1, 3, 1));
+                const __m128 x = _mm_add_ps(x0, _mm_mul_ps(fraction, _mm_sub_ps(x1, x0)));
+
+                const __m128 tapped = _mm_mul_ps(x, outTap);
+                _mm_store_ps(taps + 4 * t, g == 0 ? tapped : _mm_add_ps(_mm_load_ps(taps + 4 * t), tapped));
+
+                // One-pole lowpass in the loop: highs decay faster
+                lowpass = _mm_add_ps(x, _mm_mul_ps(damp, _mm_sub_ps(lowpass, x)));
+                _mm_store_ps(feedback + t * lines + 4 * g, _mm_mul_ps(lowpass, gain));
+            }
+
+            _mm_store_ps(damped + 4 * g, lowpass);
+        }
+
+        // Pass 2, per sample: mix all lines, add the input
+        __m128 inGain[groups];
+        for (int g = 0; g < groups; ++g)
+            inGain[g] = _mm_load_ps(inputGain + 4 * g);
+
+        for (int t = 0; t < n; ++t)
+        {
+            float* frame = feedback + t * lines;
+            __m128 v[groups];
+            for (int g = 0; g < groups; ++g)
+                v[g] = _mm_load_ps(frame + 4 * g);
+
+            hadamard<groups>(v);
+
+            const __m128 input = _mm_castpd_ps(_mm_load1_pd((const double*)(inputFrames + 2 * t)));
+            for (int g = 0; g < groups; ++g)
+                _mm_store_ps(frame + 4 * g, _mm_add_ps(v[g], _mm_mul_ps(input, inGain[g])));
+
+            // [L, R, L, R] -> L and R summed over the even and odd lines
+            const __m128 sum = _mm_load_ps(taps + 4 * t);
+            _mm_storel_pi((__m64*)(outputFrames + 2 * t), _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        }
+
+        writeFeedback<groups>(n);
+    }
+
+    /** Transposes the chunk's [sample][line] feedback into the line rings. */
+    template <int groups>
+    void writeFeedback(int n) noexcept
+    {
+        constexpr int lines = 4 * groups;
+        const int mask = ringSize - 1;
+
+        for (int g = 0; g < groups; ++g)
+        {
+            float* dest[4];
+            for (int k = 0; k < 4; ++k)
+                dest[k] = ring.data() + (size_t)((4 * g + k) * getLineStride());
+
+            // The buffer has room for a whole last step
+            for (int t = 0; t < n; t += 4)
+            {
+                __m128 r0 = _mm_load_ps(feedback + t * lines + 4 * g);
+                __m128 r1 = _mm_load_ps(feedback + (t + 1) * lines + 4 * g);
+                __m128 r2 = _mm_load_ps(feedback + (t + 2) * lines + 4 * g);
+                __m128 r3 = _mm_load_ps(feedback + (t + 3) * lines + 4 * g);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                const int pos = (writePos + t) & mask;
+                const int count = juce::jmin(4, n - t);
+
+                if (count == 4 && pos + 4 <= ringSize)
+                {
+                    _mm_storeu_ps(dest[0] + pos, r0);
+                    _mm_storeu_ps(dest[1] + pos, r1);
+                    _mm_storeu_ps(dest[2] + pos, r2);
+                    _mm_storeu_ps(dest[3] + pos, r3);
+                    continue;
+                }
+
+                alignas(16) float samples[4][4];
+                _mm_store_ps(samples[0], r0);
+                _mm_store_ps(samples[1], r1);
+                _mm_store_ps(samples[2], r2);
+                _mm_store_ps(samples[3], r3);
+                for (int k = 0; k < 4; ++k)
+                    for (int j = 0; j < count; ++j)
+                        dest[k][(pos + j) & mask] = samples[k][j];
+            }
+
+            for (int k = 0; k < 4; ++k)
+                dest[k][ringSize] = dest[k][0];
+        }
+
+        writePos = (writePos + n) & mask;
+    }
+
+    /** out = in * (1 - mix / 5) + mix * wet, with the wet channels crossfed for the width. */
+    void mixInto(float* left, float* right, float width, int n) const noexcept
+    {
+        const __m128 direct = _mm_set1_ps(0.5f * (1.0f + width));
+        const __m128 cross = _mm_set1_ps(0.5f * (1.0f - width));
+        const __m128 dryScale = _mm_set1_ps(0.2f);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const bool stereo = right != left;
+
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 a = _mm_load_ps(outputFrames + 2 * i);
+            const __m128 b = _mm_load_ps(outputFrames + 2 * i + 4);
+            const __m128 wetL = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 wetR = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+            const __m128 mix = _mm_load_ps(mixRamp + i);
+            const __m128 dry = _mm_sub_ps(one, _mm_mul_ps(dryScale, mix));
+
+            const __m128 l = _mm_mul_ps(mix, _mm_add_ps(_mm_mul_ps(direct, wetL), _mm_mul_ps(cross, wetR)));
+            _mm_storeu_ps(left + i, _mm_add_ps(_mm_mul_ps(dry, _mm_loadu_ps(left + i)), l));
+
+            if (stereo)
+            {
+                const __m128 r = _mm_mul_ps(mix, _mm_add_ps(_mm_mul_ps(direct, wetR), _mm_mul_ps(cross, wetL)));
+                _mm_storeu_ps(right + i, _mm_add_ps(_mm_mul_ps(dry, _mm_loadu_ps(right + i)), r));
+            }
+        }
+
+        const float directGain = 0.5f * (1.0f + width), crossGain = 0.5f * (1.0f - width);
+        for (; i < n; ++i)
+        {
+            const float wetL = outputFrames[2 * i], wetR = outputFrames[2 * i + 1];
+            const float dry = 1.0f - 0.2f * mixRamp[i];
+
+            left[i] = dry * left[i] + mixRamp[i] * (directGain * wetL + crossGain * wetR);
+            if (stereo)
+                right[i] = dry * right[i] + mixRamp[i] * (directGain * wetR + crossGain * wetL);
+        }
+    }
+
+    std::vector<float> ring; // maxLines rings of ringSize samples, see getLineStride()
+    int ringSize = 0;
+    int writePos = 0;
+    double currentSampleRate = 44100.0;
+    Quality quality = Quality::Lines16;
+    float decaySize = -1.0f;
+
+    alignas(16) float baseDelay[maxLines] {};
+    alignas(16) float lineDelay[maxLines] {};
+    alignas(16) float lfoPhase[maxLines] {};
+    alignas(16) float lfoIncrement[maxLines] {};
+    alignas(16) float lineGain[maxLines] {};
+    alignas(16) float damped[maxLines] {};
+    alignas(16) float inputGain[maxLines] {};
+    alignas(16) float outputTap[maxLines] {};
+
+    alignas(16) float mixRamp[chunkSize] {};
+    alignas(16) float inputFrames[2 * chunkSize] {};
+    alignas(16) float outputFrames[2 * chunkSize] {};
+    alignas(16) float taps[4 * chunkSize] {};
+    alignas(16) float feedback[(chunkSize + 3) * maxLines] {};
 
     juce::LinearSmoothedValue<float> sizeSmoother { 0.5f };
     juce::LinearSmoothedValue<float> dampingSmoother { 0.5f };
@@ -23,9 +23,11 @@ namespace NEURONiK::DSP {
 struct GlobalParams {
     float masterLevel = 0.8f;
     float saturationAmt = 0.0f;
+    int saturationQuality = 0; // 0 = off, 1 = 2x, 2 = 4x oversampling
     float delayTime = 0.3f, delayFB = 0.4f;
     float chorusMix = 0.0f;
     float reverbMix = 0.0f;
+    int reverbQuality = 1; // 0 = 8 lines, 1 = 16 lines
     
     struct LFOParams {
         int waveform = 0;
@@ -74,7 +76,7 @@ public:
     virtual void getEnvelopeLevels(float& amp, float& filter) const = 0;
     virtual void getModulationValues(float* destination, int count) const = 0;
 
-    /** Load a spectral model into the engine. */
+    /** Load a spectral model into the engine. Not from the audio thread: it allocates a new model bank. */
     virtual void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) = 0;
 
     /** Set the maximum number of active voices. */
@@ -82,6 +84,20 @@ public:
 
     /** Set global parameters. */
     virtual void setGlobalParams(const GlobalParams& p) = 0;
+
+    /** Name of the SIMD kernel variant selected for this CPU (e.g. "AVX2"). */
+    virtual const char* getActiveKernelName() const = 0;
+
+    /**
+     * Number of threads rendering voices, including the audio thread (1 = inline).
+     * The workers are spawned in prepare(); this only selects how many of them
+     * take part, so it is safe to call while renderNextBlock runs.
+     */
+    virtual void setRenderThreads(int numThreads) = 0;
+    virtual int getRenderThreads() const = 0;
+
+    /** MIDI events within this many samples after another event share its split (1 = sample-exact). */
+    virtual void setMidiGranularity(int numSamples) = 0;
 };
 
 } // namespace NEURONiK::DSP
@@ -32,6 +32,9 @@ public:
     /** Stops the note. */
     virtual void noteOff(float velocity, bool allowTail) = 0;
 
+    /** Fades the note out within a few milliseconds; used when the voice is stolen. */
+    virtual void fastRelease() = 0;
+
     // --- MPE / Per-Note Modulation ---
     virtual void notePitchBend(float bendSemitones) = 0;
     virtual void notePressure(float pressure) = 0;
@@ -77,6 +80,21 @@ public:
     float modAmpSustain = 0.0f;
     float modAmpRelease = 0.0f;
 
+    // Audio-rate modulation of the destinations read per sample (level, cutoff).
+    // Engine-owned lanes, already offset to the segment being rendered; when
+    // null the voice falls back to the scalar values above.
+    const float* modLevelLane = nullptr;
+    const float* modCutoffLane = nullptr;
+
+    // Cutoff modulation of 1.0 moves the filter by this many Hz
+    static constexpr float cutoffModRangeHz = 18000.0f;
+
+    void setModulationLanes(const float* levelLane, const float* cutoffLane) noexcept
+    {
+        modLevelLane = levelLane;
+        modCutoffLane = cutoffLane;
+    }
+
     virtual void resetModulations() {
         modLevel = modCutoff = modResonance = modFilterRes = modMorphX = modMorphY = 0.0f;
         modInharmonicity = modRoughness = modParity = modShift = modRolloff = modUnison = 0.0f;
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    ParameterChannel.h
+    Created: 16 Oct 2026
+    Description: Lock-free triple buffer for handing parameter structs to the
+                 audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace NEURONiK::DSP {
+
+/**
+ * Single-writer / single-reader triple buffer.
+ *
+ * The writer fills a private back slot and swaps it into the shared middle slot;
+ * the reader swaps the middle slot into its private front slot only when a new
+ * value was published. Neither side ever blocks or allocates.
+ *
+ * Every publish bumps a version counter, so consumers holding a pointer to the
+ * front snapshot can tell whether they need to re-latch.
+ *
+ * Thread-Safety:
+ * - publish: one writer thread.
+ * - acquire: one reader thread (Audio Thread). The returned snapshot stays
+ *   valid and unchanged until the next acquire().
+ */
+template <typename T>
+class ParameterChannel
+{
+public:
+    struct Snapshot
+    {
+        T value {};
+        uint32_t version = 0;
+    };
+
+    ParameterChannel() = default;
+
+    /** Copies value into the back slot and makes it the newest snapshot. */
+    void publish(const T& value) noexcept
+    {
+        auto& slot = slots[(size_t)backIndex];
+        slot.value = value;
+        slot.version = ++writeVersion;
+
+        const int previous = middle.exchange(backIndex | freshBit, std::memory_order_acq_rel);
+        backIndex = previous & indexMask;
+    }
+
+    /** Returns the newest published snapshot (or the current one if nothing new). */
+    const Snapshot& acquire() noexcept
+    {
+        if ((middle.load(std::memory_order_relaxed) & freshBit) != 0)
+        {
+            const int previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+            frontIndex = previous & indexMask;
+        }
+
+        return slots[(size_t)frontIndex];
+    }
+
+private:
+    static constexpr int indexMask = 0x3;
+    static constexpr int freshBit = 0x4;
+
+    std::array<Snapshot, 3> slots {};
+    std::atomic<int> middle { 1 };
+
+    int backIndex = 0;      // writer only
+    int frontIndex = 2;     // reader only
+    uint32_t writeVersion = 0;
+
+    ParameterChannel(const ParameterChannel&) = delete;
+    ParameterChannel& operator=(const ParameterChannel&) = delete;
+};
+
+} // namespace NEURONiK::DSP
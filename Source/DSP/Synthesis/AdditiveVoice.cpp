@@ -13,9 +13,12 @@
 
 namespace NEURONiK::DSP::Synthesis {
 
+const AdditiveVoice::Params AdditiveVoice::defaultParams {};
+
 AdditiveVoice::AdditiveVoice()
 {
     filter.setType(NEURONiK::DSP::Core::FilterBank::FilterType::LowPass);
+    filter.setTopology(NEURONiK::DSP::Core::FilterBank::Topology::StateVariable);
     filter.setCutoff(2000.0f);
     filter.setResonance(0.1f);
 }
@@ -47,9 +50,9 @@ void AdditiveVoice::noteOn(int midiNoteNumber, float velocity)
     currentNote = midiNoteNumber;
     
     float curvedVelocity = velocity;
-    if (pendingParams.velocityCurve == 1) // Soft
+    if (params->velocityCurve == 1) // Soft
         curvedVelocity = velocity * velocity;
-    else if (pendingParams.velocityCurve == 2) // Hard
+    else if (params->velocityCurve == 2) // Hard
         curvedVelocity = std::sqrt(velocity);
 
     currentVelocity = curvedVelocity;
@@ -77,9 +80,18 @@ void AdditiveVoice::noteOff(float /*velocity*/, bool allowTail)
     }
 }
 
+void AdditiveVoice::fastRelease()
+{
+    ampEnvelope.fastRelease();
+}
+
 void AdditiveVoice::updateParameters()
 {
-    currentParams = pendingParams;
+    if (latchedVersion == paramsVersion)
+        return;
+
+    latchedVersion = paramsVersion;
+    const Params& currentParams = *params;
 
     ampEnvelope.setParameters(currentParams.attack, 
                               currentParams.decay, 
@@ -105,6 +117,23 @@ void AdditiveVoice::updateParameters()
 }
 
 bool AdditiveVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+{
+    if (!controlTick(numSamples))
+        return false;
+
+    for (int offset = 0; offset < numSamples; offset += resonatorChunkSize)
+    {
+        const int chunk = juce::jmin(resonatorChunkSize, numSamples - offset);
+        renderPreparedBlock(resonatorBuffer, chunk);
+
+        for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+            outputBuffer.addFrom(channel, startSample + offset, resonatorBuffer, chunk);
+    }
+
+    return isActive();
+}
+
+bool AdditiveVoice::controlTick(int numSamples)
 {
     if (ampEnvelope.getCurrentState() == NEURONiK::DSP::Core::Envelope::State::Idle)
     {
@@ -112,16 +141,17 @@ bool AdditiveVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int
         return false;
     }
 
-    // Update DSP modules once per block
-    float startMorphX = juce::jlimit(0.0f, 1.0f, morphXSmoother.getNextValue() + modMorphX);
-    float startMorphY = juce::jlimit(0.0f, 1.0f, morphYSmoother.getNextValue() + modMorphY);
-    float startInharmonicity = juce::jlimit(0.0f, 1.0f, inharmonicitySmoother.getNextValue() + modInharmonicity);
-    float startRoughness = juce::jlimit(0.0f, 1.0f, roughnessSmoother.getNextValue() + modRoughness);
-    float startParity = juce::jlimit(0.0f, 1.0f, paritySmoother.getNextValue() + modParity);
-    float startShift = juce::jlimit(0.0f, 2.0f, shiftSmoother.getNextValue() + modShift);
-    float startRollOff = juce::jlimit(0.0f, 1.0f, rollOffSmoother.getNextValue());
-    float startDetune = juce::jlimit(0.0f, 0.1f, unisonDetuneSmoother.getNextValue() + modUnison);
-    float startSpread = juce::jlimit(0.0f, 1.0f, unisonSpreadSmoother.getNextValue());
+    // Update DSP modules once per control interval; the smoothers advance by its
+    // length so their ramp time is in samples
+    float startMorphX = juce::jlimit(0.0f, 1.0f, morphXSmoother.skip(numSamples) + modMorphX);
+    float startMorphY = juce::jlimit(0.0f, 1.0f, morphYSmoother.skip(numSamples) + modMorphY);
+    float startInharmonicity = juce::jlimit(0.0f, 1.0f, inharmonicitySmoother.skip(numSamples) + modInharmonicity);
+    float startRoughness = juce::jlimit(0.0f, 1.0f, roughnessSmoother.skip(numSamples) + modRoughness);
+    float startParity = juce::jlimit(0.0f, 1.0f, paritySmoother.skip(numSamples) + modParity);
+    float startShift = juce::jlimit(0.0f, 2.0f, shiftSmoother.skip(numSamples) + modShift);
+    float startRollOff = juce::jlimit(0.0f, 1.0f, rollOffSmoother.skip(numSamples));
+    float startDetune = juce::jlimit(0.0f, 0.1f, unisonDetuneSmoother.skip(numSamples) + modUnison);
+    float startSpread = juce::jlimit(0.0f, 1.0f, unisonSpreadSmoother.skip(numSamples));
 
     resonator.setStretching(startInharmonicity);
     resonator.setEntropy(startRoughness * 0.5f);
@@ -130,49 +160,68 @@ bool AdditiveVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int
     resonator.setRollOff(startRollOff);
     resonator.setUnison(startDetune, startSpread);
     resonator.updateHarmonicsFromModels(startMorphX, startMorphY);
-    resonator.prepareEntropy(numSamples);
-
-    for (int i = 1; i < numSamples; ++i) {
-        morphXSmoother.getNextValue(); morphYSmoother.getNextValue();
-        inharmonicitySmoother.getNextValue(); roughnessSmoother.getNextValue();
-        paritySmoother.getNextValue(); shiftSmoother.getNextValue();
-        rollOffSmoother.getNextValue();
-        unisonDetuneSmoother.getNextValue(); unisonSpreadSmoother.getNextValue();
-    }
 
-    for (int i = 0; i < numSamples; ++i)
+    return true;
+}
+
+void AdditiveVoice::renderPreparedBlock(float* output, int numSamples)
+{
+    resonator.processBlock(output, numSamples);
+    finishBlock(output, numSamples);
+}
+
+void AdditiveVoice::finishBlock(float* samples, int numSamples)
+{
+    for (int start = 0; start < numSamples; start += envelopeChunkSize)
     {
-        float currentCutoff = cutoffSmoother.getNextValue();
-        float currentRes = resSmoother.getNextValue();
-
-        float rawSample = resonator.processSample(i);
-        float fEnv = filterEnvelope.processSample();
-        
-        float targetCutoff = currentCutoff + modCutoff + (fEnv * currentParams.fEnvAmount * 18000.0f);
-        filter.setCutoff(juce::jlimit(20.0f, 20000.0f, targetCutoff));
-        filter.setResonance(currentRes);
-        
-        float filteredSample = filter.processSample(rawSample);
-        float envValue = ampEnvelope.processSample();
-        float levelMod = juce::jlimit(0.0f, 2.0f, currentParams.oscLevel + modLevel);
-        float finalSample = filteredSample * envValue * currentVelocity * levelMod;
-        
-        for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+        const int chunk = juce::jmin(envelopeChunkSize, numSamples - start);
+        float* chunkSamples = samples + start;
+
+        // Both envelopes rendered segment-wise for the whole chunk
+        filterEnvelope.processBlock(filterEnvelopeBuffer, chunk);
+        ampEnvelope.processBlock(ampEnvelopeBuffer, chunk);
+
+        if (modLevelLane != nullptr && modCutoffLane != nullptr)
         {
-            outputBuffer.addSample(channel, startSample + i, finalSample);
+            for (int k = 0; k < chunk; ++k)
+                chunkSamples[k] = processPostResonator(chunkSamples[k], modCutoffLane[start + k] * cutoffModRangeHz, modLevelLane[start + k],
+                                                       filterEnvelopeBuffer[k], ampEnvelopeBuffer[k]);
+        }
+        else
+        {
+            for (int k = 0; k < chunk; ++k)
+                chunkSamples[k] = processPostResonator(chunkSamples[k], modCutoff, modLevel,
+                                                       filterEnvelopeBuffer[k], ampEnvelopeBuffer[k]);
         }
     }
-    
-    // Sanitize output to prevent NaN propagation
-    if (NEURONiK::DSP::sanitizeAudioBuffer(outputBuffer, startSample, numSamples))
+
+    sanitizeOutput(samples, numSamples);
+}
+
+float AdditiveVoice::processPostResonator(float rawSample, float cutoffMod, float levelMod, float filterEnv, float ampEnv)
+{
+    float currentCutoff = cutoffSmoother.getNextValue();
+    float currentRes = resSmoother.getNextValue();
+
+    float targetCutoff = currentCutoff + cutoffMod + (filterEnv * params->fEnvAmount * 18000.0f);
+    filter.setModulatedParameters(targetCutoff, currentRes);
+
+    float filteredSample = filter.processSample(rawSample);
+    float level = juce::jlimit(0.0f, 2.0f, params->oscLevel + levelMod);
+    return filteredSample * ampEnv * currentVelocity * level;
+}
+
+void AdditiveVoice::sanitizeOutput(float* samples, int numSamples)
+{
+    // Only this voice's own samples are checked, so a bad voice never silences the others
+    if (!NEURONiK::DSP::isBlockFinite(samples, numSamples))
     {
         #if JUCE_DEBUG
         DBG("WARNING: NaN/Inf detected in AdditiveVoice output - voice reset");
         #endif
+        juce::FloatVectorOperations::clear(samples, numSamples);
         reset(); // Emergency reset
     }
-    
-    return ampEnvelope.getCurrentState() != NEURONiK::DSP::Core::Envelope::State::Idle;
 }
 
 bool AdditiveVoice::isActive() const
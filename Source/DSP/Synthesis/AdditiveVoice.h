@@ -17,7 +17,7 @@
 
 namespace NEURONiK::DSP::Synthesis {
 
-class AdditiveVoice : public IVoice
+class AdditiveVoice final : public IVoice
 {
 public:
     AdditiveVoice();
@@ -46,6 +46,7 @@ public:
     void prepare(double sampleRate, int samplesPerBlock) override;
     void noteOn(int midiNoteNumber, float velocity) override;
     void noteOff(float velocity, bool allowTail) override;
+    void fastRelease() override;
     bool renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
     bool isActive() const override;
     int getCurrentlyPlayingNote() const override { return currentNote; }
@@ -61,22 +62,58 @@ public:
     void noteTimbre(float timbre) override;
 
     // --- Specific API ---
-    void setParams(const Params& p) { pendingParams = p; }
+    /**
+     * Points the voice at the engine's shared parameter snapshot. Nothing is
+     * copied; updateParameters() re-latches only when the version changes.
+     */
+    void setParams(const Params* p, uint32_t version) noexcept { params = p; paramsVersion = version; }
     const NEURONiK::DSP::Core::Resonator& getResonator() const { return resonator; }
-    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) { resonator.loadModel(model, slot); }
+    NEURONiK::DSP::Core::Resonator& getResonator() { return resonator; }
+    const std::array<float, 64>& getPartialAmplitudes() const { return resonator.getPartialAmplitudes(); }
+
+    // --- Split rendering (used by the engine's cross-voice resonator batch) ---
+    /**
+     * Control-rate half of renderNextBlock: advances the smoothers by numSamples and
+     * re-derives the resonator harmonics, which every segment up to the next call
+     * reuses. Returns false if the voice is idle.
+     */
+    bool controlTick(int numSamples);
+    /** Renders the resonator per voice with the values latched at controlTick (entropy-capable path), mono, into output. */
+    void renderPreparedBlock(float* output, int numSamples);
+    /** Applies filter, envelopes and level in place to an externally rendered resonator signal. */
+    void finishBlock(float* samples, int numSamples);
+    bool canBatchResonator() const { return !resonator.isEntropyActive(); }
+    void setModelBank(const NEURONiK::DSP::Core::ModelBank* bank) noexcept { resonator.setModelBank(bank); }
+    void setMorphCache(NEURONiK::DSP::Core::MorphCache* cache) noexcept { resonator.setMorphCache(cache); }
+    static const NEURONiK::DSP::Core::ModelBank::Ptr& getDefaultModelBank() { return NEURONiK::DSP::Core::Resonator::getDefaultModelBank(); }
     
     // For visualization
     float getAmpEnvelopeLevel() const { return ampEnvelope.getLastOutput(); }
     float getFilterEnvelopeLevel() const { return filterEnvelope.getLastOutput(); }
 
 private:
+    float processPostResonator(float rawSample, float cutoffMod, float levelMod, float filterEnv, float ampEnv);
+    void sanitizeOutput(float* samples, int numSamples);
+
     NEURONiK::DSP::Core::Resonator resonator;
     NEURONiK::DSP::Core::Envelope ampEnvelope;
     NEURONiK::DSP::Core::Envelope filterEnvelope;
     NEURONiK::DSP::Core::FilterBank filter;
 
-    Params currentParams;
-    Params pendingParams;
+    // Mono scratch for the IVoice renderNextBlock path (the engine renders into its own scratch)
+    static constexpr int resonatorChunkSize = 256;
+    alignas(16) float resonatorBuffer[resonatorChunkSize] = {};
+
+    // Envelope values for one stretch of finishBlock
+    static constexpr int envelopeChunkSize = 64;
+    alignas(16) float ampEnvelopeBuffer[envelopeChunkSize] = {};
+    alignas(16) float filterEnvelopeBuffer[envelopeChunkSize] = {};
+
+    // Shared snapshot owned by the engine's ParameterChannel (never null)
+    static const Params defaultParams;
+    const Params* params = &defaultParams;
+    uint32_t paramsVersion = 0;
+    uint32_t latchedVersion = ~0u;
 
     int currentNote = -1;
     int midiChannel = 1;
@@ -13,6 +13,8 @@
 
 namespace NEURONiK::DSP::Synthesis {
 
+const NeurotikVoice::Params NeurotikVoice::defaultParams {};
+
 NeurotikVoice::NeurotikVoice()
 {
 }
@@ -35,7 +37,7 @@ void NeurotikVoice::noteOn(int midiNoteNumber, float velocity)
     baseFreq = (float)juce::MidiMessage::getMidiNoteInHertz(midiNoteNumber);
     
     resonatorBank.setBaseFrequency(baseFreq);
-    impulseTrigger = 1.0f;
+    exciter.triggerImpulse();
     ampEnvelope.noteOn();
 }
 
@@ -45,53 +47,80 @@ void NeurotikVoice::noteOff(float velocity, bool /*allowTail*/)
     ampEnvelope.noteOff();
 }
 
+void NeurotikVoice::fastRelease()
+{
+    ampEnvelope.fastRelease();
+}
+
 bool NeurotikVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
 {
     if (!isActive()) return false;
 
-    // Apply per-block modulations to the resonator bank
-    float mX = juce::jlimit(0.0f, 1.0f, morphXSmoother.getNextValue() + modMorphX);
-    float mY = juce::jlimit(0.0f, 1.0f, morphYSmoother.getNextValue() + modMorphY);
-    float res = juce::jlimit(0.0f, 1.0f, resonanceSmoother.getNextValue() + modResonance);
-    float detune = juce::jlimit(0.0f, 0.1f, unisonDetuneSmoother.getNextValue() + modUnison);
+    bool stillActive = true;
+    for (int offset = 0; offset < numSamples; offset += renderChunkSize)
+    {
+        const int chunk = juce::jmin(renderChunkSize, numSamples - offset);
+        controlTick(chunk);
+        stillActive = renderMono(renderBuffer, chunk);
+
+        for (int ch = 0; ch < outputBuffer.getNumChannels(); ++ch)
+            outputBuffer.addFrom(ch, startSample + offset, renderBuffer, chunk);
+    }
+
+    return stillActive;
+}
+
+bool NeurotikVoice::controlTick(int numSamples)
+{
+    if (!isActive())
+        return false;
+
+    // Apply the control-rate modulations to the resonator bank; the smoothers
+    // advance by the control interval so their ramp time is in samples
+    float mX = juce::jlimit(0.0f, 1.0f, morphXSmoother.skip(numSamples) + modMorphX);
+    float mY = juce::jlimit(0.0f, 1.0f, morphYSmoother.skip(numSamples) + modMorphY);
+    float res = juce::jlimit(0.0f, 1.0f, resonanceSmoother.skip(numSamples) + modResonance);
+    float detune = juce::jlimit(0.0f, 0.1f, unisonDetuneSmoother.skip(numSamples) + modUnison);
     
     resonatorBank.updateParameters(mX, mY, res, detune);
+    return true;
+}
 
-    for (int i = 0; i < numSamples; ++i)
+bool NeurotikVoice::renderMono(float* output, int numSamples)
+{
+    if (!isActive())
     {
-        // 1. Generate Noise
-        float rawNoise = (random.nextFloat() * 2.0f - 1.0f);
-        
-        // 2. Color Noise (Simple One-Pole Filter)
-        // Map 0.0 -> 1.0 to a coefficient
-        float alpha = juce::jlimit(0.01f, 0.99f, currentParams.excitationColor);
-        float coloredNoise = alpha * rawNoise + (1.0f - alpha) * lastNoiseSample;
-        lastNoiseSample = coloredNoise;
-
-        // 3. Combine with Impulse
-        float exciteAmt = juce::jlimit(0.0f, 1.0f, currentParams.excitationNoise + modInharmonicity);
-        float excitation = (coloredNoise * (1.0f - currentParams.impulseMix)) + (impulseTrigger * currentParams.impulseMix);
-        excitation *= exciteAmt;
-        
-        // Clear impulse after first use in block
-        impulseTrigger = 0.0f;
-
-        float voiceSample = resonatorBank.processSample(excitation);
-        float env = ampEnvelope.processSample();
-        
-        float levelMod = juce::jlimit(0.0f, 2.0f, currentParams.level + modLevel);
-        float finalSample = voiceSample * env * currentVelocity * levelMod;
-        
-        for (int ch = 0; ch < outputBuffer.getNumChannels(); ++ch)
-            outputBuffer.addSample(ch, startSample + i, finalSample);
+        juce::FloatVectorOperations::clear(output, numSamples);
+        return false;
+    }
+
+    // Modulation is bound per segment, so the exciter picks it up here
+    exciter.setParameters(params->excitationColor, params->excitationNoise + modInharmonicity, params->impulseMix);
+
+    for (int start = 0; start < numSamples; start += excitationChunkSize)
+    {
+        const int chunk = juce::jmin(excitationChunkSize, numSamples - start);
+
+        // Coloured noise plus the note-on impulse, generated for the whole chunk
+        exciter.process(excitationBuffer, chunk);
+        ampEnvelope.processBlock(envelopeBuffer, chunk);
+
+        for (int k = 0; k < chunk; ++k)
+        {
+            const int i = start + k;
+            float voiceSample = resonatorBank.processSample(excitationBuffer[k]);
+            float levelMod = juce::jlimit(0.0f, 2.0f, params->level + (modLevelLane != nullptr ? modLevelLane[i] : modLevel));
+            output[i] = voiceSample * envelopeBuffer[k] * currentVelocity * levelMod;
+        }
     }
     
-    // Sanitize output to prevent NaN propagation
-    if (NEURONiK::DSP::sanitizeAudioBuffer(outputBuffer, startSample, numSamples))
+    // Only this voice's own samples are checked, so a bad voice never silences the others
+    if (!NEURONiK::DSP::isBlockFinite(output, numSamples))
     {
         #if JUCE_DEBUG
         DBG("WARNING: NaN/Inf detected in NeurotikVoice output - voice reset");
         #endif
+        juce::FloatVectorOperations::clear(output, numSamples);
         reset(); // Emergency reset
     }
 
@@ -111,7 +140,11 @@ bool NeurotikVoice::isActive() const
 
 void NeurotikVoice::updateParameters()
 {
-    currentParams = pendingParams;
+    if (latchedVersion == paramsVersion)
+        return;
+
+    latchedVersion = paramsVersion;
+    const Params& currentParams = *params;
     
     ampEnvelope.setParameters(currentParams.attack,
                               currentParams.decay,
@@ -127,6 +160,7 @@ void NeurotikVoice::updateParameters()
 void NeurotikVoice::reset()
 {
     resonatorBank.reset();
+    exciter.reset();
     ampEnvelope.reset();
     currentNote = -1;
     mpePitchBend = 0.0f;
@@ -13,13 +13,14 @@
 #include "../IVoice.h"
 #include "../CoreModules/ResonatorBank.h"
 #include "../CoreModules/Envelope.h"
+#include "../CoreModules/ExcitationGenerator.h"
 #include <juce_core/juce_core.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <array>
 
 namespace NEURONiK::DSP::Synthesis {
 
-class NeurotikVoice : public IVoice
+class NeurotikVoice final : public IVoice
 {
 public:
     NeurotikVoice();
@@ -42,6 +43,7 @@ public:
     void prepare(double sampleRate, int samplesPerBlock) override;
     void noteOn(int midiNoteNumber, float velocity) override;
     void noteOff(float velocity, bool allowTail) override;
+    void fastRelease() override;
     bool renderNextBlock(juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override;
     bool isActive() const override;
     int getCurrentlyPlayingNote() const override { return currentNote; }
@@ -56,30 +58,53 @@ public:
     void notePressure(float pressure) override;
     void noteTimbre(float timbre) override;
 
-    void setParams(const Params& p) { pendingParams = p; }
+    /**
+     * Points the voice at the engine's shared parameter snapshot. Nothing is
+     * copied; updateParameters() re-latches only when the version changes.
+     */
+    void setParams(const Params* p, uint32_t version) noexcept { params = p; paramsVersion = version; }
+
+    /**
+     * Control-rate half of renderMono: advances the smoothers by numSamples and
+     * updates the resonator bank, which every segment up to the next call reuses.
+     * Runs serially (it may use the shared morph cache). Returns false if the voice is idle.
+     */
+    bool controlTick(int numSamples);
+    /** Renders numSamples mono samples into output (overwriting it) with the values latched at controlTick. Returns false once the voice has finished. */
+    bool renderMono(float* output, int numSamples);
     // For visualization
     float getAmpEnvelopeLevel() const { return ampEnvelope.getLastOutput(); }
     float getFilterEnvelopeLevel() const { return 0.0f; }
-    void loadModel(const NEURONiK::Common::SpectralModel& model, int slot) { resonatorBank.loadModel(model, slot); }
+    void setModelBank(const Core::ModelBank* bank) noexcept { resonatorBank.setModelBank(bank); }
+    void setMorphCache(Core::MorphCache* cache) noexcept { resonatorBank.setMorphCache(cache); }
+    void setResonatorMode(Core::ResonatorBank::Mode mode) noexcept { resonatorBank.setMode(mode); }
+    static const Core::ModelBank::Ptr& getDefaultModelBank() { return Core::ResonatorBank::getDefaultModelBank(); }
     const std::array<float, 64>& getPartialAmplitudes() const { return resonatorBank.getPartialAmplitudes(); }
 
 private:
     Core::ResonatorBank resonatorBank;
     Core::Envelope ampEnvelope;
+    Core::ExcitationGenerator exciter;
     
-    Params currentParams;
-    Params pendingParams;
+    // Shared snapshot owned by the engine's ParameterChannel (never null)
+    static const Params defaultParams;
+    const Params* params = &defaultParams;
+    uint32_t paramsVersion = 0;
+    uint32_t latchedVersion = ~0u;
 
     int currentNote = -1;
     int midiChannel = 1;
     float currentVelocity = 0.0f;
     float baseFreq = 440.0f;
 
-    juce::Random random;
-    
-    // Excitation state
-    float lastNoiseSample = 0.0f;
-    float impulseTrigger = 0.0f;
+    // Mono scratch for the IVoice renderNextBlock path (the engine renders into its own scratch)
+    static constexpr int renderChunkSize = 256;
+    alignas(16) float renderBuffer[renderChunkSize] = {};
+
+    // Excitation and envelope for one stretch of renderMono
+    static constexpr int excitationChunkSize = 64;
+    alignas(16) float excitationBuffer[excitationChunkSize] = {};
+    alignas(16) float envelopeBuffer[excitationChunkSize] = {};
 
     // MPE State
     float mpePitchBend = 0.0f;
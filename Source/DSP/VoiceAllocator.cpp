@@ -0,0 +1,193 @@
+/*
+  ==============================================================================
+
+    VoiceAllocator.cpp
+    Created: 16 Oct 2026
+    Description: Implementation of the engine voice allocator.
+
+  ==============================================================================
+*/
+
+#include "VoiceAllocator.h"
+
+namespace NEURONiK::DSP {
+
+void VoiceAllocator::reset(int numVoices) noexcept
+{
+    numVoices = juce::jlimit(0, maxVoices, numVoices);
+
+    held = {};
+    released = {};
+    stolen = {};
+
+    slots.fill(Slot::Free);
+    prev.fill(noVoice);
+    next.fill(noVoice);
+    voiceKey.fill(-1);
+    voiceChannel.fill(0);
+    noteTable.fill(noVoice);
+    channelMasks.fill(0);
+    busyMask = 0;
+
+    // Lowest index on top, so voices are handed out in order
+    numFree = 0;
+    for (int v = numVoices - 1; v >= 0; --v)
+        freeStack[(size_t)numFree++] = (int8_t)v;
+}
+
+int VoiceAllocator::tableIndex(int channel, int note) noexcept
+{
+    return (juce::jlimit(1, numChannels, channel) - 1) * numNotes + juce::jlimit(0, numNotes - 1, note);
+}
+
+int VoiceAllocator::findVoice(int channel, int note) const noexcept
+{
+    return noteTable[(size_t)tableIndex(channel, note)];
+}
+
+uint64_t VoiceAllocator::getChannelMask(int channel) const noexcept
+{
+    return channelMasks[(size_t)juce::jlimit(1, numChannels, channel)];
+}
+
+int VoiceAllocator::chooseVictim() const noexcept
+{
+    // Released voices are already decaying, so the oldest of them is the quietest bet
+    return released.head != noVoice ? released.head : held.head;
+}
+
+void VoiceAllocator::markStolen(int voice) noexcept
+{
+    if (voice == noVoice || slots[(size_t)voice] == Slot::Free)
+        return;
+
+    forgetNote(voice);
+    moveTo(voice, Slot::Stolen);
+}
+
+int VoiceAllocator::takeVoice(bool& wasStolen) noexcept
+{
+    wasStolen = false;
+
+    if (numFree > 0)
+        return freeStack[(size_t)--numFree];
+
+    // Every voice is busy: cut the stolen voice that has been fading the longest
+    const int voice = stolen.head;
+    if (voice == noVoice)
+        return noVoice;
+
+    unlink(stolen, voice);
+    slots[(size_t)voice] = Slot::Free;
+    channelMasks[(size_t)voiceChannel[(size_t)voice]] &= ~(uint64_t(1) << voice);
+    busyMask &= ~(uint64_t(1) << voice);
+
+    wasStolen = true;
+    return voice;
+}
+
+void VoiceAllocator::noteStarted(int voice, int channel, int note) noexcept
+{
+    const int key = tableIndex(channel, note);
+    const auto bit = uint64_t(1) << voice;
+
+    noteTable[(size_t)key] = (int8_t)voice;
+    voiceKey[(size_t)voice] = (int16_t)key;
+    voiceChannel[(size_t)voice] = (int8_t)juce::jlimit(1, numChannels, channel);
+
+    channelMasks[(size_t)voiceChannel[(size_t)voice]] |= bit;
+    busyMask |= bit;
+
+    moveTo(voice, Slot::Held);
+}
+
+int VoiceAllocator::noteReleased(int channel, int note) noexcept
+{
+    const int voice = findVoice(channel, note);
+    if (voice == noVoice)
+        return noVoice;
+
+    forgetNote(voice);
+    moveTo(voice, Slot::Released);
+    return voice;
+}
+
+void VoiceAllocator::voiceFinished(int voice) noexcept
+{
+    if (slots[(size_t)voice] == Slot::Free)
+        return;
+
+    forgetNote(voice);
+    unlink(listFor(slots[(size_t)voice]), voice);
+    slots[(size_t)voice] = Slot::Free;
+
+    const auto bit = uint64_t(1) << voice;
+    channelMasks[(size_t)voiceChannel[(size_t)voice]] &= ~bit;
+    busyMask &= ~bit;
+
+    freeStack[(size_t)numFree++] = (int8_t)voice;
+}
+
+VoiceAllocator::List& VoiceAllocator::listFor(Slot slot) noexcept
+{
+    // Free voices live in freeStack, never in a list
+    jassert(slot != Slot::Free);
+
+    if (slot == Slot::Released) return released;
+    if (slot == Slot::Stolen)   return stolen;
+    return held;
+}
+
+void VoiceAllocator::pushBack(List& list, int voice) noexcept
+{
+    prev[(size_t)voice] = (int8_t)list.tail;
+    next[(size_t)voice] = noVoice;
+
+    if (list.tail != noVoice)
+        next[(size_t)list.tail] = (int8_t)voice;
+    else
+        list.head = voice;
+
+    list.tail = voice;
+    ++list.size;
+}
+
+void VoiceAllocator::unlink(List& list, int voice) noexcept
+{
+    const int before = prev[(size_t)voice];
+    const int after = next[(size_t)voice];
+
+    if (before != noVoice) next[(size_t)before] = (int8_t)after;
+    else                   list.head = after;
+
+    if (after != noVoice) prev[(size_t)after] = (int8_t)before;
+    else                  list.tail = before;
+
+    prev[(size_t)voice] = noVoice;
+    next[(size_t)voice] = noVoice;
+    --list.size;
+}
+
+void VoiceAllocator::moveTo(int voice, Slot slot) noexcept
+{
+    const Slot current = slots[(size_t)voice];
+    if (current != Slot::Free)
+        unlink(listFor(current), voice);
+
+    slots[(size_t)voice] = slot;
+    pushBack(listFor(slot), voice);
+}
+
+void VoiceAllocator::forgetNote(int voice) noexcept
+{
+    const int key = voiceKey[(size_t)voice];
+    if (key < 0)
+        return;
+
+    if (noteTable[(size_t)key] == voice)
+        noteTable[(size_t)key] = noVoice;
+
+    voiceKey[(size_t)voice] = -1;
+}
+
+} // namespace NEURONiK::DSP
@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+
+    VoiceAllocator.h
+    Created: 16 Oct 2026
+    Description: Constant-time voice bookkeeping for the engines: free list,
+                 steal order and (channel, note) -> voice lookup.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cstdint>
+
+#if JUCE_MSVC
+ #include <intrin.h>
+#endif
+
+namespace NEURONiK::DSP {
+
+/**
+ * Tracks which voice plays what, without touching the voices themselves.
+ *
+ * Every voice is in exactly one list:
+ * - free:     idle, ready for a new note (stack).
+ * - held:     key down, oldest note first.
+ * - released: key up and in its release tail, oldest release first.
+ * - stolen:   fading out after being stolen, oldest steal first.
+ *
+ * Held and released voices count against the polyphony limit; stolen voices
+ * do not, so a stolen voice fades out while the new note already plays on a
+ * free voice. Every operation is O(1) apart from the per-voice callbacks of
+ * forEachVoice(), which visit only the voices in the given mask.
+ *
+ * Thread-Safety:
+ * - Audio Thread only.
+ */
+class VoiceAllocator
+{
+public:
+    static constexpr int maxVoices = 64;
+    static constexpr int noVoice = -1;
+
+    VoiceAllocator() = default;
+
+    /** Marks the first numVoices voices free and forgets every note. */
+    void reset(int numVoices) noexcept;
+
+    /** Voice currently holding (channel, note) or noVoice. Channels are 1..16. */
+    int findVoice(int channel, int note) const noexcept;
+
+    /** Held plus released voices, i.e. the ones that count against polyphony. */
+    int getNumSounding() const noexcept { return held.size + released.size; }
+
+    /** Next voice to steal: the oldest released one, else the oldest held one. */
+    int chooseVictim() const noexcept;
+
+    /** Moves a sounding voice to the stolen list (the caller starts its fast release). */
+    void markStolen(int voice) noexcept;
+
+    /**
+     * Pops a free voice. If none is left, takes the oldest stolen voice instead and
+     * sets wasStolen, in which case the caller must hard-reset it before reuse.
+     */
+    int takeVoice(bool& wasStolen) noexcept;
+
+    /** Registers a note that just started on voice (which must come from takeVoice). */
+    void noteStarted(int voice, int channel, int note) noexcept;
+
+    /** Moves the voice holding (channel, note) to the released list and returns it. */
+    int noteReleased(int channel, int note) noexcept;
+
+    /** Returns a voice that fell silent to the free list. */
+    void voiceFinished(int voice) noexcept;
+
+    /** Voices that are not free (bit i = voice i). */
+    uint64_t getBusyMask() const noexcept { return busyMask; }
+
+    /** Busy voices started on the given MIDI channel. */
+    uint64_t getChannelMask(int channel) const noexcept;
+
+    /** Calls fn(voiceIndex) for every set bit of mask, lowest first. */
+    template <typename Fn>
+    static void forEachVoice(uint64_t mask, Fn&& fn)
+    {
+        while (mask != 0)
+        {
+            fn(lowestSetBit(mask));
+            mask &= mask - 1;
+        }
+    }
+
+private:
+    enum class Slot : uint8_t { Free, Held, Released, Stolen };
+
+    struct List
+    {
+        int head = noVoice;
+        int tail = noVoice;
+        int size = 0;
+    };
+
+    static constexpr int numChannels = 16;
+    static constexpr int numNotes = 128;
+
+    static int tableIndex(int channel, int note) noexcept;
+
+    static int lowestSetBit(uint64_t mask) noexcept
+    {
+       #if JUCE_MSVC
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return (int)index;
+       #else
+        return __builtin_ctzll(mask);
+       #endif
+    }
+
+    List& listFor(Slot slot) noexcept;
+    void pushBack(List& list, int voice) noexcept;
+    void unlink(List& list, int voice) noexcept;
+    void moveTo(int voice, Slot slot) noexcept;
+    void forgetNote(int voice) noexcept;
+
+    List held, released, stolen;
+
+    std::array<Slot, maxVoices> slots {};
+    std::array<int8_t, maxVoices> prev {};
+    std::array<int8_t, maxVoices> next {};
+    std::array<int16_t, maxVoices> voiceKey {};  // table index of the note, -1 if none
+    std::array<int8_t, maxVoices> voiceChannel {};
+
+    std::array<int8_t, maxVoices> freeStack {};
+    int numFree = 0;
+
+    std::array<int8_t, numChannels * numNotes> noteTable {};
+    std::array<uint64_t, numChannels + 1> channelMasks {};
+    uint64_t busyMask = 0;
+};
+
+} // namespace NEURONiK::DSP
@@ -0,0 +1,238 @@
+/*
+  ==============================================================================
+
+    VoiceRenderPool.cpp
+    Created: 16 Oct 2026
+    Description: Implementation of the voice rendering worker pool.
+
+  ==============================================================================
+*/
+
+#include "VoiceRenderPool.h"
+#include <thread>
+
+#if JUCE_INTEL
+ #include <immintrin.h>
+#endif
+
+namespace NEURONiK::DSP {
+
+namespace {
+
+inline void spinPause() noexcept
+{
+   #if JUCE_INTEL
+    _mm_pause();
+   #else
+    std::this_thread::yield();
+   #endif
+}
+
+// How long a worker keeps spinning after its last block before it goes to sleep
+constexpr int64_t workerSpinMicros = 4;
+
+} // namespace
+
+//==============================================================================
+class VoiceRenderPool::Worker : public juce::Thread
+{
+public:
+    Worker(VoiceRenderPool& p, int laneIndex)
+        : juce::Thread("NEURONiK Voice Worker " + juce::String(laneIndex)), pool(p), lane(laneIndex)
+    {
+    }
+
+    void run() override
+    {
+        const int64_t spinTicks = juce::jmax((int64_t)1, (juce::Time::getHighResolutionTicksPerSecond() * workerSpinMicros) / 1000000);
+        uint32_t lastGeneration = pool.generation.load(std::memory_order_acquire);
+
+        while (!threadShouldExit())
+        {
+            if (tryParticipate(lastGeneration))
+                continue;
+
+            // Spin briefly so back-to-back blocks don't pay for a wake-up
+            const int64_t spinUntil = juce::Time::getHighResolutionTicks() + spinTicks;
+            bool joined = false;
+
+            while (!joined && juce::Time::getHighResolutionTicks() < spinUntil)
+            {
+                for (int i = 0; i < 16; ++i)
+                    spinPause();
+
+                joined = tryParticipate(lastGeneration);
+            }
+
+            if (joined)
+                continue;
+
+            // Announce the sleep before the final check, so run() either sees the
+            // flag and signals or this check sees the block it opened
+            sleeping.store(true, std::memory_order_seq_cst);
+
+            if (!tryParticipate(lastGeneration) && !threadShouldExit())
+                wakeUp.wait();
+
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /** Called by the audio thread after opening a block. */
+    void wakeIfSleeping() noexcept
+    {
+        if (sleeping.exchange(false, std::memory_order_seq_cst))
+            wakeUp.signal();
+    }
+
+    void stop()
+    {
+        signalThreadShouldExit();
+        wakeUp.signal();
+        stopThread(1000);
+    }
+
+private:
+    bool tryParticipate(uint32_t& lastGeneration) noexcept
+    {
+        const uint32_t current = pool.generation.load(std::memory_order_seq_cst);
+        if ((current & 1u) != 0 || current == lastGeneration)
+            return false;
+
+        pool.participate(current, lane);
+        lastGeneration = current;
+        return true;
+    }
+
+    VoiceRenderPool& pool;
+    const int lane;
+    juce::WaitableEvent wakeUp;
+    std::atomic<bool> sleeping { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+};
+
+//==============================================================================
+VoiceRenderPool::VoiceRenderPool() = default;
+
+VoiceRenderPool::~VoiceRenderPool()
+{
+    stopWorkers();
+}
+
+void VoiceRenderPool::stopWorkers()
+{
+    for (auto& w : workers)
+        w->signalThreadShouldExit();
+
+    for (auto& w : workers)
+        w->stop();
+
+    workers.clear();
+}
+
+void VoiceRenderPool::prepare()
+{
+    if (!workers.empty())
+        return;
+
+    // Idle workers sleep on their event, so the unused ones cost nothing
+    const int numWorkers = juce::jmin(maxLanes, juce::SystemStats::getNumCpus()) - 1;
+
+    workers.reserve((size_t)juce::jmax(0, numWorkers));
+    for (int lane = 1; lane <= numWorkers; ++lane)
+    {
+        auto worker = std::make_unique<Worker>(*this, lane);
+        worker->startRealtimeThread(juce::Thread::RealtimeOptions{}.withPriority(9));
+        workers.push_back(std::move(worker));
+    }
+}
+
+void VoiceRenderPool::run(JobFunction function, void* context, int numJobs) noexcept
+{
+    if (numJobs <= 0)
+        return;
+
+    const int lanes = juce::jmin(numLanes.load(std::memory_order_relaxed), (int)workers.size() + 1);
+    if (lanes <= 1)
+    {
+        for (int j = 0; j < numJobs; ++j)
+            function(context, j, 0);
+        return;
+    }
+
+    // Publish the block: one contiguous range per lane keeps neighbouring voices together
+    jobFunction = function;
+    jobContext = context;
+    jobsDone.store(0, std::memory_order_relaxed);
+    blockLanes.store(lanes, std::memory_order_relaxed);
+
+    for (int lane = 0; lane < lanes; ++lane)
+    {
+        ranges[(size_t)lane].next.store((lane * numJobs) / lanes, std::memory_order_relaxed);
+        ranges[(size_t)lane].end = ((lane + 1) * numJobs) / lanes;
+    }
+
+    generation.fetch_add(1, std::memory_order_seq_cst); // open
+
+    // Workers beyond the active lanes stay asleep
+    for (int w = 0; w < lanes - 1; ++w)
+        workers[(size_t)w]->wakeIfSleeping();
+
+    drain(0);
+
+    while (jobsDone.load(std::memory_order_acquire) < numJobs)
+        spinPause();
+
+    // Close the block and wait for stragglers to leave before the ranges can be reused
+    generation.fetch_add(1, std::memory_order_seq_cst);
+
+    while (workersInside.load(std::memory_order_seq_cst) != 0)
+        spinPause();
+}
+
+void VoiceRenderPool::participate(uint32_t jobGeneration, int lane) noexcept
+{
+    workersInside.fetch_add(1, std::memory_order_seq_cst);
+
+    // Re-check after registering: the block may have closed in between. While it
+    // is open, blockLanes holds this block's value
+    if (generation.load(std::memory_order_seq_cst) == jobGeneration
+        && lane < blockLanes.load(std::memory_order_relaxed))
+        drain(lane);
+
+    workersInside.fetch_sub(1, std::memory_order_release);
+}
+
+void VoiceRenderPool::drain(int lane) noexcept
+{
+    int jobIndex = 0;
+    while (claimJob(lane, jobIndex))
+    {
+        jobFunction(jobContext, jobIndex, lane);
+        jobsDone.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool VoiceRenderPool::claimJob(int lane, int& jobIndex) noexcept
+{
+    // Own range first, then steal from the following lanes
+    const int lanes = blockLanes.load(std::memory_order_relaxed);
+    for (int i = 0; i < lanes; ++i)
+    {
+        auto& range = ranges[(size_t)((lane + i) % lanes)];
+        if (range.next.load(std::memory_order_relaxed) >= range.end)
+            continue;
+
+        const int claimed = range.next.fetch_add(1, std::memory_order_relaxed);
+        if (claimed < range.end)
+        {
+            jobIndex = claimed;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace NEURONiK::DSP
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    VoiceRenderPool.h
+    Created: 16 Oct 2026
+    Description: Pre-spawned real-time worker threads for rendering voices in
+                 parallel with the audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace NEURONiK::DSP {
+
+/**
+ * Fork/join pool for per-block voice rendering.
+ *
+ * The calling (audio) thread is lane 0; lanes 1..N-1 are worker threads, all
+ * spawned up front by prepare(). setNumLanes() only changes how many of them
+ * take part in the next blocks, so it never creates or joins a thread. run() splits the jobs into one contiguous range per lane and every
+ * lane claims from its own range first, then steals from the others, using only
+ * atomic counters. Workers that are asleep when a block starts simply miss it:
+ * the remaining lanes (at worst the caller alone) drain all jobs, so run() never
+ * waits on a thread that has not started working.
+ *
+ * Workers spin for a few microseconds after each block and then sleep on an
+ * event. run() signals only the workers that have announced they are asleep,
+ * so back-to-back blocks stay free of system calls while idle workers cost
+ * nothing.
+ *
+ * Thread-Safety:
+ * - prepare: Message thread, never concurrently with run().
+ * - setNumLanes: Any thread; takes effect at the next run().
+ * - run: Audio thread only. No allocation; the only system call is the wake-up
+ *   of a sleeping worker.
+ */
+class VoiceRenderPool
+{
+public:
+    using JobFunction = void (*)(void* context, int jobIndex, int lane) noexcept;
+
+    static constexpr int maxLanes = 16;
+
+    VoiceRenderPool();
+    ~VoiceRenderPool();
+
+    /** Spawns one worker per additional CPU (at most maxLanes - 1), unless already done. */
+    void prepare();
+
+    /** Number of rendering lanes including the caller (1 = everything inline), capped by the spawned workers. */
+    void setNumLanes(int newNumLanes) noexcept { numLanes.store(juce::jlimit(1, maxLanes, newNumLanes), std::memory_order_relaxed); }
+    int getNumLanes() const noexcept { return numLanes.load(std::memory_order_relaxed); }
+
+    /** Runs function(context, job, lane) for every job in [0, numJobs) and returns when all are done. */
+    void run(JobFunction function, void* context, int numJobs) noexcept;
+
+private:
+    class Worker;
+
+    void participate(uint32_t jobGeneration, int lane) noexcept;
+    void drain(int lane) noexcept;
+    bool claimJob(int lane, int& jobIndex) noexcept;
+    void stopWorkers();
+
+    struct alignas(64) LaneRange
+    {
+        std::atomic<int> next { 0 };
+        int end = 0;
+    };
+
+    std::array<LaneRange, maxLanes> ranges;
+    JobFunction jobFunction = nullptr;
+    void* jobContext = nullptr;
+    std::atomic<int> numLanes { 1 };
+
+    // Lanes taking part in the current block; only changes while no block is open
+    std::atomic<int> blockLanes { 1 };
+
+    // Even = a block is open for workers, odd = closed
+    alignas(64) std::atomic<uint32_t> generation { 1 };
+    alignas(64) std::atomic<int> jobsDone { 0 };
+    alignas(64) std::atomic<int> workersInside { 0 };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VoiceRenderPool)
+};
+
+} // namespace NEURONiK::DSP
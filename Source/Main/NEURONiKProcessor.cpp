@@ -8,10 +8,24 @@
 
 using namespace NEURONiK::State;
 
+// Parameter IDs in NEURONiKProcessor::EngineParam order
+static constexpr const char* engineParamIDs[] =
+{
+    IDs::oscLevel, IDs::envAttack, IDs::envDecay, IDs::envSustain, IDs::envRelease,
+    IDs::filterCutoff, IDs::filterRes, IDs::filterEnvAmount, IDs::filterAttack, IDs::filterDecay, IDs::filterSustain, IDs::filterRelease,
+    IDs::morphX, IDs::morphY, IDs::oscInharmonicity, IDs::oscRoughness,
+    IDs::resonatorParity, IDs::resonatorShift, IDs::resonatorRolloff, IDs::unisonDetune, IDs::unisonSpread,
+    IDs::oscExciteNoise, IDs::excitationColor, IDs::impulseMix, IDs::resonatorRes,
+
+    IDs::masterLevel, IDs::fxSaturation, IDs::fxSaturationQuality, IDs::fxDelayTime, IDs::fxDelayFeedback, IDs::fxChorusMix, IDs::fxReverbMix, IDs::fxReverbQuality,
+    IDs::lfo1Waveform, IDs::lfo1RateHz, IDs::lfo1Depth, IDs::lfo2Waveform, IDs::lfo2RateHz, IDs::lfo2Depth,
+    IDs::mod1Source, IDs::mod1Destination, IDs::mod1Amount, IDs::mod2Source, IDs::mod2Destination, IDs::mod2Amount,
+    IDs::mod3Source, IDs::mod3Destination, IDs::mod3Amount, IDs::mod4Source, IDs::mod4Destination, IDs::mod4Amount
+};
+
 NEURONiKProcessor::NEURONiKProcessor()
     : apvts(*this, nullptr, "Parameters", createParameterLayout()),
-      midiFifo(1024),
-      commandFifo(32)
+      midiFifo(1024)
 {
     presetManager = std::make_unique<NEURONiK::Serialization::PresetManager>(apvts);
     midiMappingManager = std::make_unique<NEURONiK::Main::MidiMappingManager>(apvts);
@@ -20,6 +34,16 @@ NEURONiKProcessor::NEURONiKProcessor()
         engine = std::make_unique<NEURONiK::DSP::NeuronikEngine>();
     else
         engine = std::make_unique<NEURONiK::DSP::NeurotikEngine>();
+    activeEngineType = initialEngineType;
+
+    static_assert(std::size(engineParamIDs) == static_cast<size_t>(numEngineParams),
+                  "engineParamIDs must list every EngineParam");
+    for (size_t i = 0; i < engineParamBindings.size(); ++i)
+    {
+        engineParamBindings[i] = apvts.getRawParameterValue(engineParamIDs[i]);
+        jassert(engineParamBindings[i] != nullptr);
+        engineParamValues[i] = engineParamBindings[i]->load();
+    }
 
     keyboardState.addListener(this);
 
@@ -92,6 +116,7 @@ NEURONiKProcessor::NEURONiKProcessor()
 
 NEURONiKProcessor::~NEURONiKProcessor()
 {
+    cancelPendingUpdate();
     apvts.state.removeListener(this);
     keyboardState.removeListener(this);
     for (auto& param : getParameters())
@@ -104,7 +129,9 @@ NEURONiKProcessor::~NEURONiKProcessor()
 void NEURONiKProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     if (engine) engine->prepare(sampleRate, samplesPerBlock);
+    updateLatency((int)apvts.getRawParameterValue(IDs::fxSaturationQuality)->load());
     keyboardState.reset();
+    doublePrecisionBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
 }
 
 void NEURONiKProcessor::setPolyphony(int numVoices)
@@ -115,6 +142,19 @@ void NEURONiKProcessor::setPolyphony(int numVoices)
 }
 
 int NEURONiKProcessor::getPolyphony() const { return currentPolyphony.load(); }
+
+void NEURONiKProcessor::setRenderThreads(int numThreads)
+{
+    const int newCount = juce::jlimit(1, juce::jmin(NEURONiK::DSP::VoiceRenderPool::maxLanes, juce::SystemStats::getNumCpus()), numThreads);
+    currentRenderThreads.store(newCount);
+
+    // Only selects how many of the engine's pre-spawned workers run, so the audio
+    // callback is never blocked; the swap lock keeps the engine from being replaced
+    const juce::ScopedLock swapLock(engineSwapLock);
+    if (engine) engine->setRenderThreads(newCount);
+}
+
+int NEURONiKProcessor::getRenderThreads() const { return currentRenderThreads.load(); }
 NEURONiKProcessor::EditorSettings& NEURONiKProcessor::getEditorSettings() { return editorSettings; }
 void NEURONiKProcessor::releaseResources() {}
 
@@ -149,7 +189,8 @@ void NEURONiKProcessor::parameterChanged(const juce::String& parameterID, float
         int type = static_cast<int>(newValue);
         
         // This is safe to run on UI thread (called by APVTS)
-        // Swap engine
+        // Swap engine; model loads wait until the new one is in place
+        const juce::ScopedLock swapLock(engineSwapLock);
         std::unique_ptr<NEURONiK::DSP::ISynthesisEngine> newEngine;
         if (type == 0)
             newEngine = std::make_unique<NEURONiK::DSP::NeuronikEngine>();
@@ -159,6 +200,7 @@ void NEURONiKProcessor::parameterChanged(const juce::String& parameterID, float
         // Prepare new engine
         newEngine->prepare(getSampleRate(), getBlockSize());
         newEngine->setPolyphony(currentPolyphony.load());
+        newEngine->setRenderThreads(currentRenderThreads.load());
         
         // Load models into new engine
         for (int i = 0; i < 4; ++i)
@@ -174,110 +216,144 @@ void NEURONiKProcessor::parameterChanged(const juce::String& parameterID, float
         // Swap (Atomic unique_ptr swap is not atomic, so we need a lock if processBlock runs)
         {
             const juce::ScopedLock engineLock(getCallbackLock());
-            engine = std::move(newEngine);
+            std::swap(engine, newEngine);
+            activeEngineType = type;
+            engineParamsStale = true;
+        }
+
+        // The old engine joins its render workers, so it is destroyed outside the callback lock
+        newEngine.reset();
+    }
+    else if (parameterID == IDs::fxSaturationQuality)
+    {
+        // setLatencySamples notifies the host synchronously, so never from here
+        triggerAsyncUpdate();
+    }
+}
+
+void NEURONiKProcessor::handleAsyncUpdate()
+{
+    updateLatency((int)apvts.getRawParameterValue(IDs::fxSaturationQuality)->load());
+}
+
+uint64_t NEURONiKProcessor::pollEngineParams() noexcept
+{
+    uint64_t dirty = 0;
+    for (int i = 0; i < numEngineParams; ++i)
+    {
+        const float value = engineParamBindings[(size_t)i]->load(std::memory_order_relaxed);
+        if (value != engineParamValues[(size_t)i])
+        {
+            engineParamValues[(size_t)i] = value;
+            dirty |= uint64_t(1) << i;
         }
     }
+    return dirty;
 }
 
 void NEURONiKProcessor::synchronizeEngineParameters()
 {
     if (!engine) return;
 
-    if (auto* nEngine = dynamic_cast<NEURONiK::DSP::NeuronikEngine*>(engine.get()))
+    uint64_t dirty = pollEngineParams();
+    if (engineParamsStale)
     {
-        ::NEURONiK::DSP::Synthesis::AdditiveVoice::Params vParams;
-        vParams.oscLevel = apvts.getRawParameterValue(IDs::oscLevel)->load();
-        vParams.attack = apvts.getRawParameterValue(IDs::envAttack)->load() * 1000.0f;
-        vParams.decay = apvts.getRawParameterValue(IDs::envDecay)->load() * 1000.0f;
-        vParams.sustain = apvts.getRawParameterValue(IDs::envSustain)->load();
-        vParams.release = apvts.getRawParameterValue(IDs::envRelease)->load() * 1000.0f;
-        vParams.filterCutoff = apvts.getRawParameterValue(IDs::filterCutoff)->load();
-        vParams.filterRes = apvts.getRawParameterValue(IDs::filterRes)->load();
-        vParams.fEnvAmount = apvts.getRawParameterValue(IDs::filterEnvAmount)->load();
-        vParams.fAttack = apvts.getRawParameterValue(IDs::filterAttack)->load() * 1000.0f;
-        vParams.fDecay = apvts.getRawParameterValue(IDs::filterDecay)->load() * 1000.0f;
-        vParams.fSustain = apvts.getRawParameterValue(IDs::filterSustain)->load();
-        vParams.fRelease = apvts.getRawParameterValue(IDs::filterRelease)->load() * 1000.0f;
-        vParams.morphX = apvts.getRawParameterValue(IDs::morphX)->load();
-        vParams.morphY = apvts.getRawParameterValue(IDs::morphY)->load();
-        vParams.inharmonicity = apvts.getRawParameterValue(IDs::oscInharmonicity)->load();
-        vParams.roughness = apvts.getRawParameterValue(IDs::oscRoughness)->load();
-        vParams.resonatorParity = apvts.getRawParameterValue(IDs::resonatorParity)->load();
-        vParams.resonatorShift = apvts.getRawParameterValue(IDs::resonatorShift)->load();
-        vParams.resonatorRollOff = apvts.getRawParameterValue(IDs::resonatorRolloff)->load();
-        vParams.unisonDetune = apvts.getRawParameterValue(IDs::unisonDetune)->load();
-        vParams.unisonSpread = apvts.getRawParameterValue(IDs::unisonSpread)->load();
-        
-        nEngine->setVoiceParams(vParams);
+        dirty = voiceParamMask | globalParamMask;
+        engineParamsStale = false;
+    }
 
-        ::NEURONiK::DSP::GlobalParams gParams;
-        gParams.masterLevel = apvts.getRawParameterValue(IDs::masterLevel)->load();
-        gParams.saturationAmt = apvts.getRawParameterValue(IDs::fxSaturation)->load();
-        gParams.delayTime = apvts.getRawParameterValue(IDs::fxDelayTime)->load();
-        gParams.delayFB = apvts.getRawParameterValue(IDs::fxDelayFeedback)->load();
-        gParams.chorusMix = apvts.getRawParameterValue(IDs::fxChorusMix)->load();
-        gParams.reverbMix = apvts.getRawParameterValue(IDs::fxReverbMix)->load();
-        gParams.lfo1.waveform = (int)apvts.getRawParameterValue(IDs::lfo1Waveform)->load();
-        gParams.lfo1.rateHz = apvts.getRawParameterValue(IDs::lfo1RateHz)->load();
-        gParams.lfo1.depth = apvts.getRawParameterValue(IDs::lfo1Depth)->load();
-        gParams.lfo2.waveform = (int)apvts.getRawParameterValue(IDs::lfo2Waveform)->load();
-        gParams.lfo2.rateHz = apvts.getRawParameterValue(IDs::lfo2RateHz)->load();
-        gParams.lfo2.depth = apvts.getRawParameterValue(IDs::lfo2Depth)->load();
+    using P = EngineParam;
 
-        for (int i = 0; i < 4; ++i)
+    if ((dirty & voiceParamMask) != 0)
+    {
+        if (activeEngineType == 0)
         {
-            juce::String prefix = "mod" + juce::String(i+1);
-            gParams.modMatrix[i].source = (int)apvts.getRawParameterValue(prefix + "Source")->load();
-            gParams.modMatrix[i].destination = (int)apvts.getRawParameterValue(prefix + "Destination")->load();
-            gParams.modMatrix[i].amount = apvts.getRawParameterValue(prefix + "Amount")->load();
+            ::NEURONiK::DSP::Synthesis::AdditiveVoice::Params vParams;
+            vParams.oscLevel = getEngineParam(P::OscLevel);
+            vParams.attack = getEngineParam(P::EnvAttack) * 1000.0f;
+            vParams.decay = getEngineParam(P::EnvDecay) * 1000.0f;
+            vParams.sustain = getEngineParam(P::EnvSustain);
+            vParams.release = getEngineParam(P::EnvRelease) * 1000.0f;
+            vParams.filterCutoff = getEngineParam(P::FilterCutoff);
+            vParams.filterRes = getEngineParam(P::FilterRes);
+            vParams.fEnvAmount = getEngineParam(P::FilterEnvAmount);
+            vParams.fAttack = getEngineParam(P::FilterAttack) * 1000.0f;
+            vParams.fDecay = getEngineParam(P::FilterDecay) * 1000.0f;
+            vParams.fSustain = getEngineParam(P::FilterSustain);
+            vParams.fRelease = getEngineParam(P::FilterRelease) * 1000.0f;
+            vParams.morphX = getEngineParam(P::MorphX);
+            vParams.morphY = getEngineParam(P::MorphY);
+            vParams.inharmonicity = getEngineParam(P::OscInharmonicity);
+            vParams.roughness = getEngineParam(P::OscRoughness);
+            vParams.resonatorParity = getEngineParam(P::ResonatorParity);
+            vParams.resonatorShift = getEngineParam(P::ResonatorShift);
+            vParams.resonatorRollOff = getEngineParam(P::ResonatorRolloff);
+            vParams.unisonDetune = getEngineParam(P::UnisonDetune);
+            vParams.unisonSpread = getEngineParam(P::UnisonSpread);
+
+            static_cast<NEURONiK::DSP::NeuronikEngine*>(engine.get())->setVoiceParams(vParams);
+        }
+        else
+        {
+            ::NEURONiK::DSP::Synthesis::NeurotikVoice::Params ntParams;
+            ntParams.level = getEngineParam(P::OscLevel);
+            ntParams.attack = getEngineParam(P::EnvAttack) * 1000.0f;
+            ntParams.decay = getEngineParam(P::EnvDecay) * 1000.0f;
+            ntParams.sustain = getEngineParam(P::EnvSustain);
+            ntParams.release = getEngineParam(P::EnvRelease) * 1000.0f;
+            ntParams.morphX = getEngineParam(P::MorphX);
+            ntParams.morphY = getEngineParam(P::MorphY);
+            ntParams.excitationNoise = getEngineParam(P::OscExciteNoise);
+            ntParams.excitationColor = getEngineParam(P::ExcitationColor);
+            ntParams.impulseMix = getEngineParam(P::ImpulseMix);
+            ntParams.resonatorResonance = getEngineParam(P::ResonatorRes);
+            ntParams.unisonDetune = getEngineParam(P::UnisonDetune);
+            ntParams.unisonSpread = getEngineParam(P::UnisonSpread);
+
+            static_cast<NEURONiK::DSP::NeurotikEngine*>(engine.get())->setVoiceParams(ntParams);
         }
-        nEngine->setGlobalParams(gParams);
     }
-    else if (auto* ntEngine = dynamic_cast<NEURONiK::DSP::NeurotikEngine*>(engine.get()))
-    {
-        ::NEURONiK::DSP::Synthesis::NeurotikVoice::Params ntParams;
-        ntParams.level = apvts.getRawParameterValue(IDs::oscLevel)->load();
-        ntParams.attack = apvts.getRawParameterValue(IDs::envAttack)->load() * 1000.0f;
-        ntParams.decay = apvts.getRawParameterValue(IDs::envDecay)->load() * 1000.0f;
-        ntParams.sustain = apvts.getRawParameterValue(IDs::envSustain)->load();
-        ntParams.release = apvts.getRawParameterValue(IDs::envRelease)->load() * 1000.0f;
-        ntParams.morphX = apvts.getRawParameterValue(IDs::morphX)->load();
-        ntParams.morphY = apvts.getRawParameterValue(IDs::morphY)->load();
-        ntParams.excitationNoise = apvts.getRawParameterValue(IDs::oscExciteNoise)->load();
-        ntParams.excitationColor = apvts.getRawParameterValue(IDs::excitationColor)->load();
-        ntParams.impulseMix = apvts.getRawParameterValue(IDs::impulseMix)->load();
-        ntParams.resonatorResonance = apvts.getRawParameterValue(IDs::resonatorRes)->load();
-        ntParams.unisonDetune = apvts.getRawParameterValue(IDs::unisonDetune)->load();
-        ntParams.unisonSpread = apvts.getRawParameterValue(IDs::unisonSpread)->load();
-        
-        ntEngine->setVoiceParams(ntParams);
 
-        // Global Params for Neurotik (Unified)
+    if ((dirty & globalParamMask) != 0)
+    {
         ::NEURONiK::DSP::GlobalParams gParams;
-        gParams.masterLevel = apvts.getRawParameterValue(IDs::masterLevel)->load();
-        gParams.saturationAmt = apvts.getRawParameterValue(IDs::fxSaturation)->load();
-        gParams.delayTime = apvts.getRawParameterValue(IDs::fxDelayTime)->load();
-        gParams.delayFB = apvts.getRawParameterValue(IDs::fxDelayFeedback)->load();
-        gParams.chorusMix = apvts.getRawParameterValue(IDs::fxChorusMix)->load();
-        gParams.reverbMix = apvts.getRawParameterValue(IDs::fxReverbMix)->load();
-        gParams.lfo1.waveform = (int)apvts.getRawParameterValue(IDs::lfo1Waveform)->load();
-        gParams.lfo1.rateHz = apvts.getRawParameterValue(IDs::lfo1RateHz)->load();
-        gParams.lfo1.depth = apvts.getRawParameterValue(IDs::lfo1Depth)->load();
-        gParams.lfo2.waveform = (int)apvts.getRawParameterValue(IDs::lfo2Waveform)->load();
-        gParams.lfo2.rateHz = apvts.getRawParameterValue(IDs::lfo2RateHz)->load();
-        gParams.lfo2.depth = apvts.getRawParameterValue(IDs::lfo2Depth)->load();
-
+        gParams.masterLevel = getEngineParam(P::MasterLevel);
+        gParams.saturationAmt = getEngineParam(P::FxSaturation);
+        gParams.saturationQuality = (int)getEngineParam(P::FxSaturationQuality);
+        gParams.delayTime = getEngineParam(P::FxDelayTime);
+        gParams.delayFB = getEngineParam(P::FxDelayFeedback);
+        gParams.chorusMix = getEngineParam(P::FxChorusMix);
+        gParams.reverbMix = getEngineParam(P::FxReverbMix);
+        gParams.reverbQuality = (int)getEngineParam(P::FxReverbQuality);
+        gParams.lfo1.waveform = (int)getEngineParam(P::Lfo1Waveform);
+        gParams.lfo1.rateHz = getEngineParam(P::Lfo1RateHz);
+        gParams.lfo1.depth = getEngineParam(P::Lfo1Depth);
+        gParams.lfo2.waveform = (int)getEngineParam(P::Lfo2Waveform);
+        gParams.lfo2.rateHz = getEngineParam(P::Lfo2RateHz);
+        gParams.lfo2.depth = getEngineParam(P::Lfo2Depth);
+
+        // Source/Destination/Amount triplets are contiguous per slot
         for (int i = 0; i < 4; ++i)
         {
-            juce::String prefix = "mod" + juce::String(i+1);
-            gParams.modMatrix[i].source = (int)apvts.getRawParameterValue(prefix + "Source")->load();
-            gParams.modMatrix[i].destination = (int)apvts.getRawParameterValue(prefix + "Destination")->load();
-            gParams.modMatrix[i].amount = apvts.getRawParameterValue(prefix + "Amount")->load();
+            const int base = static_cast<int>(P::Mod1Source) + i * 3;
+            gParams.modMatrix[i].source = (int)engineParamValues[(size_t)base];
+            gParams.modMatrix[i].destination = (int)engineParamValues[(size_t)base + 1];
+            gParams.modMatrix[i].amount = engineParamValues[(size_t)base + 2];
         }
-        ntEngine->setGlobalParams(gParams);
+
+        engine->setGlobalParams(gParams);
     }
 }
 
+void NEURONiKProcessor::updateLatency(int saturationQuality)
+{
+    using Saturation = NEURONiK::DSP::Effects::Saturation;
+    const int latency = Saturation::getLatencySamples(static_cast<Saturation::Quality>(juce::jlimit(0, 2, saturationQuality)));
+
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+}
+
 void NEURONiKProcessor::enterMidiLearnMode(const juce::String& paramID)
 {
     midiLearnActive.store(true);
@@ -294,9 +370,6 @@ void NEURONiKProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     juce::ScopedNoDenormals noDenormals;
     buffer.clear();
     
-    // Run pending commands (e.g. Model Loading)
-    processCommands();
-
     // Safe MIDI injection from UI thread (Lock-Free)
     int blockSize1, blockSize2, startIndex1, startIndex2;
     midiFifo.prepareToRead(1024, startIndex1, blockSize1, startIndex2, blockSize2);
@@ -340,20 +413,22 @@ void NEURONiKProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
         }
         
         // Update filter envelope parameters for visualization
-        uiFAttack.store(apvts.getRawParameterValue(IDs::filterAttack)->load(), std::memory_order_relaxed);
-        uiFDecay.store(apvts.getRawParameterValue(IDs::filterDecay)->load(), std::memory_order_relaxed);
-        uiFSustain.store(apvts.getRawParameterValue(IDs::filterSustain)->load(), std::memory_order_relaxed);
-        uiFRelease.store(apvts.getRawParameterValue(IDs::filterRelease)->load(), std::memory_order_relaxed);
+        uiFAttack.store(getEngineParam(EngineParam::FilterAttack), std::memory_order_relaxed);
+        uiFDecay.store(getEngineParam(EngineParam::FilterDecay), std::memory_order_relaxed);
+        uiFSustain.store(getEngineParam(EngineParam::FilterSustain), std::memory_order_relaxed);
+        uiFRelease.store(getEngineParam(EngineParam::FilterRelease), std::memory_order_relaxed);
         
         // Update XY Pad parameters for visualization
-        uiMorphX.store(apvts.getRawParameterValue(IDs::morphX)->load(), std::memory_order_relaxed);
-        uiMorphY.store(apvts.getRawParameterValue(IDs::morphY)->load(), std::memory_order_relaxed);
+        uiMorphX.store(getEngineParam(EngineParam::MorphX), std::memory_order_relaxed);
+        uiMorphY.store(getEngineParam(EngineParam::MorphY), std::memory_order_relaxed);
     }
 }
 
 void NEURONiKProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midi)
 {
-    juce::AudioBuffer<float> floatBuffer(buffer.getNumChannels(), buffer.getNumSamples());
+    // Reuse the preallocated buffer; only grows if the host exceeds the prepared size
+    auto& floatBuffer = doublePrecisionBuffer;
+    floatBuffer.setSize(buffer.getNumChannels(), buffer.getNumSamples(), false, false, true);
     processBlock(floatBuffer, midi);
     for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
     {
@@ -394,25 +469,12 @@ void NEURONiKProcessor::loadModel(const juce::File& file, int slot)
     auto model = NEURONiK::Serialization::PresetManager::loadModelFromFile(file);
     if (model.isValid)
     {
-        // Safe Lock-Free Queue
-        int start1, block1, start2, block2;
-        commandFifo.prepareToWrite(1, start1, block1, start2, block2);
-        
-        if (block1 > 0)
+        // The engine builds and publishes a new shared bank right here; the audio
+        // thread only picks up the pointer, so it is never blocked. The swap lock
+        // just keeps the engine from being replaced underneath us.
         {
-            auto& cmd = commandQueue[start1];
-            cmd.type = EngineCommand::LoadModel;
-            cmd.slot = slot;
-            cmd.modelData = model; // Copy POD
-            commandFifo.finishedWrite(1);
-        }
-        else if (block2 > 0)
-        {
-            auto& cmd = commandQueue[start2];
-            cmd.type = EngineCommand::LoadModel;
-            cmd.slot = slot;
-            cmd.modelData = model; // Copy POD
-            commandFifo.finishedWrite(1);
+            const juce::ScopedLock swapLock(engineSwapLock);
+            if (engine) engine->loadModel(model, slot);
         }
 
         modelNames[slot] = file.getFileNameWithoutExtension();
@@ -423,28 +485,6 @@ void NEURONiKProcessor::loadModel(const juce::File& file, int slot)
     }
 }
 
-void NEURONiKProcessor::processCommands()
-{
-    int start1, block1, start2, block2;
-    commandFifo.prepareToRead(32, start1, block1, start2, block2);
-
-    auto processCmdBlock = [this](int start, int block) {
-        for (int i = 0; i < block; ++i)
-        {
-            const auto& cmd = commandQueue[start + i];
-            if (cmd.type == EngineCommand::LoadModel)
-            {
-                if (engine) engine->loadModel(cmd.modelData, cmd.slot);
-            }
-        }
-    };
-
-    if (block1 > 0) processCmdBlock(start1, block1);
-    if (block2 > 0) processCmdBlock(start2, block2);
-
-    commandFifo.finishedRead(block1 + block2);
-}
-
 void NEURONiKProcessor::reloadModels()
 {
     for (int i = 0; i < 4; ++i)
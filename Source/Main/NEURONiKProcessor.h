@@ -16,7 +16,8 @@ namespace NEURONiK::DSP { class NeuronikEngine; }
 class NEURONiKProcessor : public juce::AudioProcessor,
                      public juce::AudioProcessorValueTreeState::Listener,
                      public juce::MidiKeyboardState::Listener,
-                     public juce::ValueTree::Listener
+                     public juce::ValueTree::Listener,
+                     private juce::AsyncUpdater
 {
 public:
     NEURONiKProcessor();
@@ -94,6 +95,10 @@ public:
 
     void setPolyphony(int numVoices);
     int getPolyphony() const;
+
+    // --- Multi-core Voice Rendering (1 = render on the audio thread only) ---
+    void setRenderThreads(int numThreads);
+    int getRenderThreads() const;
     EditorSettings& getEditorSettings();
 
 public:
@@ -126,6 +131,10 @@ private:
     juce::MidiKeyboardState keyboardState;
     std::unique_ptr<NEURONiK::DSP::ISynthesisEngine> engine;
 
+    // Message thread only: serializes model loads and thread-count changes against engine swaps. The
+    // callback lock is held just for the pointer move itself.
+    juce::CriticalSection engineSwapLock;
+
     // --- UI MIDI Message Injection (Safe FIFO) ---
     juce::AbstractFifo midiFifo;
     struct QueuedMidiMessage {
@@ -136,18 +145,55 @@ private:
 
     void synchronizeEngineParameters();
 
-    // --- Lock-Free Command Queue (Model Loading) ---
-    struct EngineCommand {
-        enum Type { LoadModel, Reset, Unknown };
-        Type type = Unknown;
-        int slot = 0;
-        NEURONiK::Common::SpectralModel modelData;
+    /** Reports the delay of the oversampled saturation (0 = off, 1 = 2x, 2 = 4x) to the host. Message thread only. */
+    void updateLatency(int saturationQuality);
+
+    // AsyncUpdater: oversampling changes (possibly automated on the audio thread)
+    // reach the host latency from the message thread
+    void handleAsyncUpdate() override;
+
+    // --- Engine Parameter Binding Table ---
+    // Raw APVTS atomics resolved once in the constructor, so the audio thread
+    // never looks parameters up by string. Voice parameters come first; the
+    // order must match engineParamIDs in NEURONiKProcessor.cpp.
+    enum class EngineParam : int
+    {
+        OscLevel, EnvAttack, EnvDecay, EnvSustain, EnvRelease,
+        FilterCutoff, FilterRes, FilterEnvAmount, FilterAttack, FilterDecay, FilterSustain, FilterRelease,
+        MorphX, MorphY, OscInharmonicity, OscRoughness,
+        ResonatorParity, ResonatorShift, ResonatorRolloff, UnisonDetune, UnisonSpread,
+        OscExciteNoise, ExcitationColor, ImpulseMix, ResonatorRes,
+
+        // Global parameters
+        MasterLevel, FxSaturation, FxSaturationQuality, FxDelayTime, FxDelayFeedback, FxChorusMix, FxReverbMix, FxReverbQuality,
+        Lfo1Waveform, Lfo1RateHz, Lfo1Depth, Lfo2Waveform, Lfo2RateHz, Lfo2Depth,
+        Mod1Source, Mod1Destination, Mod1Amount, Mod2Source, Mod2Destination, Mod2Amount,
+        Mod3Source, Mod3Destination, Mod3Amount, Mod4Source, Mod4Destination, Mod4Amount,
+
+        Count
     };
-    
-    juce::AbstractFifo commandFifo;
-    std::array<EngineCommand, 32> commandQueue;
-    
-    void processCommands();
+
+    static constexpr int numEngineParams = static_cast<int>(EngineParam::Count);
+    static_assert(numEngineParams <= 64, "Dirty bits are kept in a single 64-bit mask");
+
+    static constexpr uint64_t voiceParamMask = (uint64_t(1) << static_cast<int>(EngineParam::MasterLevel)) - 1;
+    static constexpr uint64_t globalParamMask = ((uint64_t(1) << numEngineParams) - 1) & ~voiceParamMask;
+
+    float getEngineParam(EngineParam p) const noexcept { return engineParamValues[static_cast<size_t>(p)]; }
+
+    /** Loads every bound atomic and returns a dirty bit per parameter that changed. */
+    uint64_t pollEngineParams() noexcept;
+
+    std::array<std::atomic<float>*, numEngineParams> engineParamBindings {};
+    std::array<float, numEngineParams> engineParamValues {};
+
+    // Engine kind cached at swap time (no dynamic_cast per block). Set under the
+    // callback lock; a fresh engine gets a full parameter push.
+    int activeEngineType = 0;
+    bool engineParamsStale = true;
+
+    // Float render buffer for the double-precision processBlock (sized in prepareToPlay)
+    juce::AudioBuffer<float> doublePrecisionBuffer;
 
     std::array<juce::String, 4> modelNames;
 
@@ -162,6 +208,7 @@ private:
     std::unique_ptr<NEURONiK::Main::MidiMappingManager> midiMappingManager;
 
     std::atomic<int> currentPolyphony { 8 };
+    std::atomic<int> currentRenderThreads { 1 };
     EditorSettings editorSettings;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NEURONiKProcessor)
@@ -56,6 +56,7 @@ namespace IDs {
 
     // FX
     static constexpr const char* fxSaturation    = "fxSaturation";
+    static constexpr const char* fxSaturationQuality = "fxSaturationQuality";
     static constexpr const char* fxDelayTime     = "fxDelayTime";
     static constexpr const char* fxDelayFeedback = "fxDelayFeedback";
     static constexpr const char* fxDelaySync     = "fxDelaySync";
@@ -71,6 +72,7 @@ namespace IDs {
     static constexpr const char* fxReverbDamping = "fxReverbDamping";
     static constexpr const char* fxReverbWidth   = "fxReverbWidth";
     static constexpr const char* fxReverbMix     = "fxReverbMix";
+    static constexpr const char* fxReverbQuality = "fxReverbQuality";
 
     // Master / Global
     static constexpr const char* masterLevel    = "masterLevel";
@@ -150,6 +152,8 @@ inline juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::resonatorParity, "Odd/Even Balance", juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::resonatorShift, "Spectral Shift", juce::NormalisableRange<float>(0.5f, 2.0f, 0.0f, 0.5f), 1.0f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxSaturation, "Saturation", juce::NormalisableRange<float>(0.0f, 1.0f), 0.0f));
+    juce::StringArray saturationQualities = { "Off", "2x", "4x" };
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(IDs::fxSaturationQuality, "Saturation Oversampling", saturationQualities, 0));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxDelayTime, "Delay Time", juce::NormalisableRange<float>(0.01f, 2.0f, 0.0f, 0.5f), 0.3f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxDelayFeedback, "Delay FB", juce::NormalisableRange<float>(0.0f, 0.95f), 0.4f));
     
@@ -168,6 +172,8 @@ inline juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxReverbDamping, "Reverb Damping", juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxReverbWidth, "Reverb Width", juce::NormalisableRange<float>(0.0f, 1.0f), 1.0f));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::fxReverbMix, "Reverb Mix", juce::NormalisableRange<float>(0.0f, 1.0f), 0.0f));
+    juce::StringArray reverbQualities = { "8 Lines", "16 Lines" };
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(IDs::fxReverbQuality, "Reverb Quality", reverbQualities, 1));
     params.push_back(std::make_unique<juce::AudioParameterBool>(IDs::midiThru, "MIDI Thru", false));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(IDs::randomStrength, "Random Strength", 0.0f, 1.0f, 0.7f));
     params.push_back(std::make_unique<juce::AudioParameterBool>(IDs::freezeResonator, "Freeze Resonator", false));
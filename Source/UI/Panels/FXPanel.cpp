@@ -21,6 +21,7 @@ FXPanel::FXPanel(NEURONiKProcessor& p)
     addAndMakeVisible(masterBox);
 
     setupControl(saturation,    IDs::fxSaturation,     "DRIVE", saturationBox, ModulationTarget::FxSaturation);
+    setupChoice(saturationQuality, IDs::fxSaturationQuality, "OVERSAMPLING", saturationBox);
     
     // Delay
     setupControl(delayTime,     IDs::fxDelayTime,      "TIME", delayBox, ModulationTarget::FxDelayTime);
@@ -38,6 +39,7 @@ FXPanel::FXPanel(NEURONiKProcessor& p)
     setupControl(reverbDamping, IDs::fxReverbDamping,  "DAMP", reverbBox);
     setupControl(reverbWidth,   IDs::fxReverbWidth,    "WIDTH", reverbBox);
     setupControl(reverbMix,     IDs::fxReverbMix,      "MIX", reverbBox, ModulationTarget::Count);
+    setupChoice(reverbQuality,  IDs::fxReverbQuality,  "QUALITY", reverbBox);
 
     setupControl(masterBPM,     IDs::masterBPM,        "BPM", masterBox, ModulationTarget::Count);
 
@@ -117,8 +119,12 @@ void FXPanel::resized()
     // Saturation Content
     {
         auto c = saturationBox.getContentArea();
+        auto qualityArea = c.removeFromBottom(40);
         // Increased knob size to match delay/reverb (120 height instead of 80)
         layoutRotary(saturation, c.withSizeKeepingCentre(c.getWidth(), 120));
+
+        saturationQuality.label.setBounds(qualityArea.removeFromTop(12));
+        saturationQuality.comboBox.setBounds(qualityArea.withSizeKeepingCentre(qualityArea.getWidth(), 22).reduced(10, 0));
     }
 
     // Delay Content
@@ -152,11 +158,15 @@ void FXPanel::resized()
     // Reverb Content
     {
         auto c = reverbBox.getContentArea();
+        auto qualityArea = c.removeFromBottom(40);
         auto top = c.removeFromTop(c.getHeight() / 2);
         layoutRotary(reverbSize, top.removeFromLeft(top.getWidth() / 2));
         layoutRotary(reverbDamping, top);
         layoutRotary(reverbWidth, c.removeFromLeft(c.getWidth() / 2));
         layoutRotary(reverbMix, c);
+
+        reverbQuality.label.setBounds(qualityArea.removeFromTop(12));
+        reverbQuality.comboBox.setBounds(qualityArea.withSizeKeepingCentre(qualityArea.getWidth(), 22).reduced(10, 0));
     }
 
     // BPM Content
@@ -34,13 +34,14 @@ public:
     
     // Saturation & Delay
     RotaryControl saturation, delayTime, delayFeedback;
-    ChoiceControl delaySync, delayDivision;
+    ChoiceControl saturationQuality, delaySync, delayDivision;
 
     // Chorus
     RotaryControl chorusRate, chorusDepth, chorusMix;
 
     // Reverb
     RotaryControl reverbSize, reverbDamping, reverbWidth, reverbMix;
+    ChoiceControl reverbQuality;
 
     // BPM
     RotaryControl masterBPM;